@@ -4,6 +4,7 @@
 layout(location = 0) in vec3 inPosition;
 layout(location = 1) in vec3 inTexCoords;
 layout(location = 2) in vec4 inColor;
+layout(location = 3) in float inLayer;
 
 uniform mat4 matProjection;
 uniform mat4 matModelView;
@@ -11,21 +12,27 @@ uniform mat4 matModelView;
 #ifdef OGL33C
     out vec4 vertColor;
     out vec3 vertTexCoords;
+    out float vertLayer;
 #else
     varying vec4 vertColor;
     varying vec3 vertTexCoords;
+    varying float vertLayer;
 #endif
 
 void main(void) {
     gl_Position = matProjection * matModelView * vec4(inPosition, 1);
     vertColor = inColor / 255.0;
     vertTexCoords = inTexCoords;
+    vertLayer = inLayer;
 }
 
 #else
 // Fragment shader
 
+// Environment map
 uniform sampler2D tex0;
+// Level texture pages, one per layer
+uniform sampler2DArray texPages;
 uniform bool texturingEnabled;
 uniform bool smoothingEnabled;
 uniform bool alphaPointDiscard;
@@ -37,38 +44,63 @@ uniform float brightnessMultiplier;
     #define TEXTURESIZE textureSize
     #define TEXTURE texture
     #define TEXELFETCH texelFetch
+    #define TEXTURESIZEARRAY textureSize
+    #define TEXTUREARRAY texture
+    #define TEXELFETCHARRAY texelFetch
 
     in vec4 vertColor;
     in vec3 vertTexCoords;
+    in float vertLayer;
     out vec4 OUTCOLOR;
 #else
     #define OUTCOLOR gl_FragColor
     #define TEXTURESIZE textureSize2D
     #define TEXELFETCH texelFetch2D
     #define TEXTURE texture2D
+    #define TEXTURESIZEARRAY textureSize2DArray
+    #define TEXELFETCHARRAY texelFetch2DArray
+    #define TEXTUREARRAY texture2DArray
 
     varying vec4 vertColor;
     varying vec3 vertTexCoords;
+    varying float vertLayer;
 #endif
 
 void main(void) {
     OUTCOLOR = vertColor;
 
     if (texturingEnabled) {
+        vec2 uv = vertTexCoords.xy / vertTexCoords.z;
+        bool useEnvMap = vertLayer < -0.5;
+        float layer = floor(vertLayer + 0.5);
+
 #if defined(GL_EXT_gpu_shader4) || defined(OGL33C)
         if (alphaPointDiscard && smoothingEnabled) {
             // do not use smoothing for chroma key
-            ivec2 size = TEXTURESIZE(tex0, 0);
-            int tx = int((vertTexCoords.x / vertTexCoords.z) * size.x) % size.x;
-            int ty = int((vertTexCoords.y / vertTexCoords.z) * size.y) % size.y;
-            vec4 texel = TEXELFETCH(tex0, ivec2(tx, ty), 0);
+            vec4 texel;
+            if (useEnvMap) {
+                ivec2 size = TEXTURESIZE(tex0, 0);
+                int tx = int(uv.x * size.x) % size.x;
+                int ty = int(uv.y * size.y) % size.y;
+                texel = TEXELFETCH(tex0, ivec2(tx, ty), 0);
+            } else {
+                ivec2 size = TEXTURESIZEARRAY(texPages, 0).xy;
+                int tx = int(uv.x * size.x) % size.x;
+                int ty = int(uv.y * size.y) % size.y;
+                texel = TEXELFETCHARRAY(
+                    texPages, ivec3(tx, ty, int(layer)), 0);
+            }
             if (texel.a == 0.0) {
                 discard;
             }
         }
 #endif
 
-        vec4 texColor = TEXTURE(tex0, vertTexCoords.xy / vertTexCoords.z);
+        // Sample both outside of the branch to keep the implicit derivatives
+        // well defined.
+        vec4 envColor = TEXTURE(tex0, uv);
+        vec4 pageColor = TEXTUREARRAY(texPages, vec3(uv, layer));
+        vec4 texColor = useEnvMap ? envColor : pageColor;
         if (alphaThreshold >= 0.0 && texColor.a <= alphaThreshold) {
             discard;
         }
@@ -5,6 +5,10 @@
 
 #include <SDL2/SDL_timer.h>
 
+#if !defined(_WIN32)
+    #include <sys/resource.h>
+#endif
+
 static void M_Log(
     BENCHMARK *const b, const char *file, int32_t line, const char *func,
     Uint64 current, const char *message)
@@ -44,6 +48,23 @@ BENCHMARK *Benchmark_Start(void)
     return b;
 }
 
+size_t Benchmark_GetPeakRSS(void)
+{
+#if defined(_WIN32)
+    return 0;
+#else
+    struct rusage usage;
+    if (getrusage(RUSAGE_SELF, &usage) != 0) {
+        return 0;
+    }
+    #if defined(__APPLE__)
+    return (size_t)usage.ru_maxrss;
+    #else
+    return (size_t)usage.ru_maxrss * 1024;
+    #endif
+#endif
+}
+
 void Benchmark_Tick_Impl(
     BENCHMARK *const b, const char *const file, const int32_t line,
     const char *const func, const char *const message)
@@ -221,8 +221,5 @@ void Config_Sanitize(void)
     CLAMPL(g_Config.gameplay.maximum_save_slots, 0);
     CLAMPL(g_Config.rendering.anisotropy_filter, 1.0);
     CLAMP(g_Config.rendering.wireframe_width, 1.0, 100.0);
-
-    if (g_Config.rendering.fps != 30 && g_Config.rendering.fps != 60) {
-        g_Config.rendering.fps = 30;
-    }
+    CLAMP(g_Config.rendering.fps, CONFIG_MIN_FPS, CONFIG_MAX_FPS);
 }
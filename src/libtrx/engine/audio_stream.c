@@ -7,6 +7,8 @@
 
 #include <SDL2/SDL_audio.h>
 #include <SDL2/SDL_error.h>
+#include <SDL2/SDL_thread.h>
+#include <SDL2/SDL_timer.h>
 #include <errno.h>
 #include <libavcodec/avcodec.h>
 #include <libavcodec/codec.h>
@@ -32,6 +34,15 @@ typedef struct {
     bool is_playing;
     bool is_read_done;
     bool is_looped;
+    // Set while a worker thread opens the file. The stream only becomes
+    // playable once it is cleared.
+    bool is_loading;
+    bool is_load_paused;
+    // Set by the worker thread when opening the file fails. Once the owner
+    // has set a finish callback, the mixer ends the stream like any other so
+    // that the owner gets notified.
+    bool is_load_failed;
+    char *load_path;
     float volume;
     double duration;
     double timestamp;
@@ -63,6 +74,13 @@ typedef struct {
     struct {
         SDL_AudioStream *stream;
     } sdl;
+
+    // Resampled samples on their way to the SDL stream. Each stream has its
+    // own, as streams are decoded both by the mixer and by loader threads.
+    struct {
+        float *buffer;
+        size_t capacity;
+    } decode;
 } AUDIO_STREAM_SOUND;
 
 extern SDL_AudioDeviceID g_AudioDeviceID;
@@ -70,13 +88,18 @@ extern SDL_AudioDeviceID g_AudioDeviceID;
 static AUDIO_STREAM_SOUND m_Streams[AUDIO_MAX_ACTIVE_STREAMS] = {};
 static float m_MixBuffer[AUDIO_SAMPLES * AUDIO_WORKING_CHANNELS] = {};
 
-static size_t m_DecodeBufferCapacity = 0;
-static float *m_DecodeBuffer = nullptr;
-
 static void M_SeekToStart(AUDIO_STREAM_SOUND *stream);
 static bool M_DecodeFrame(AUDIO_STREAM_SOUND *stream);
 static bool M_EnqueueFrame(AUDIO_STREAM_SOUND *stream);
+static int32_t M_Reserve(void);
+static void M_Reset(AUDIO_STREAM_SOUND *stream);
+static int32_t M_Open(AUDIO_STREAM_SOUND *stream, const char *full_path);
+static bool M_Start(AUDIO_STREAM_SOUND *stream, bool is_playing);
 static bool M_InitialiseFromPath(int32_t sound_id, const char *file_path);
+static int M_LoadThread(void *arg);
+static void M_WaitForLoad(const AUDIO_STREAM_SOUND *stream);
+static void M_FreeResources(AUDIO_STREAM_SOUND *stream);
+static bool M_Close(int32_t sound_id);
 static void M_Clear(AUDIO_STREAM_SOUND *stream);
 
 static void M_SeekToStart(AUDIO_STREAM_SOUND *stream)
@@ -202,14 +225,14 @@ static bool M_EnqueueFrame(AUDIO_STREAM_SOUND *stream)
                 nullptr, stream->swr.dst.ch_layout.nb_channels, resampled_size,
                 stream->swr.dst.format, 1);
 
-            if (out_pos + out_buffer_size > m_DecodeBufferCapacity) {
-                m_DecodeBufferCapacity = out_pos + out_buffer_size;
-                m_DecodeBuffer =
-                    Memory_Realloc(m_DecodeBuffer, m_DecodeBufferCapacity);
+            if (out_pos + out_buffer_size > stream->decode.capacity) {
+                stream->decode.capacity = out_pos + out_buffer_size;
+                stream->decode.buffer = Memory_Realloc(
+                    stream->decode.buffer, stream->decode.capacity);
             }
-            if (m_DecodeBuffer != nullptr && out_buffer != nullptr) {
+            if (stream->decode.buffer != nullptr && out_buffer != nullptr) {
                 memcpy(
-                    (uint8_t *)m_DecodeBuffer + out_pos, out_buffer,
+                    (uint8_t *)stream->decode.buffer + out_pos, out_buffer,
                     out_buffer_size);
             }
             out_pos += out_buffer_size;
@@ -218,7 +241,8 @@ static bool M_EnqueueFrame(AUDIO_STREAM_SOUND *stream)
                 stream->swr.ctx, &out_buffer, out_samples, nullptr, 0);
         }
 
-        if (SDL_AudioStreamPut(stream->sdl.stream, m_DecodeBuffer, out_pos)) {
+        if (SDL_AudioStreamPut(
+                stream->sdl.stream, stream->decode.buffer, out_pos)) {
             LOG_ERROR("Got an error when decoding frame: %s", SDL_GetError());
             av_frame_unref(stream->av.frame);
             break;
@@ -243,24 +267,49 @@ cleanup:
     return true;
 }
 
-static bool M_InitialiseFromPath(int32_t sound_id, const char *file_path)
+static int32_t M_Reserve(void)
 {
-    ASSERT(file_path != nullptr);
-
-    if (!g_AudioDeviceID || sound_id < 0
-        || sound_id >= AUDIO_MAX_ACTIVE_STREAMS) {
-        return false;
-    }
-
-    bool ret = false;
+    int32_t result = AUDIO_NO_SOUND;
     SDL_LockAudioDevice(g_AudioDeviceID);
+    for (int32_t sound_id = 0; sound_id < AUDIO_MAX_ACTIVE_STREAMS;
+         sound_id++) {
+        AUDIO_STREAM_SOUND *const stream = &m_Streams[sound_id];
+        if (!stream->is_used) {
+            M_Reset(stream);
+            stream->is_used = true;
+            result = sound_id;
+            break;
+        }
+    }
+    SDL_UnlockAudioDevice(g_AudioDeviceID);
+    return result;
+}
 
-    int32_t error_code;
-    char *full_path = File_GetFullPath(file_path);
-
-    AUDIO_STREAM_SOUND *stream = &m_Streams[sound_id];
+static void M_Reset(AUDIO_STREAM_SOUND *const stream)
+{
+    stream->is_read_done = true;
+    stream->is_playing = false;
+    stream->is_looped = false;
+    stream->is_loading = false;
+    stream->is_load_paused = false;
+    stream->is_load_failed = false;
+    stream->volume = 1.0f;
+    stream->timestamp = 0.0;
+    stream->duration = 0.0;
+    stream->finish_callback = nullptr;
+    stream->finish_callback_user_data = nullptr;
+    stream->start_at = -1.0; // negative value means unset
+    stream->stop_at = -1.0; // negative value means unset
+}
 
-    error_code = avformat_open_input(
+// Does all the file I/O needed to start playing, up to decoding the first
+// packet. The mixer ignores streams that are not playing, and this touches
+// nothing but the stream itself, so it does not need to hold the audio device
+// lock.
+static int32_t M_Open(
+    AUDIO_STREAM_SOUND *const stream, const char *const full_path)
+{
+    int32_t error_code = avformat_open_input(
         &stream->av.format_ctx, full_path, nullptr, nullptr);
     if (error_code != 0) {
         goto cleanup;
@@ -321,50 +370,167 @@ static bool M_InitialiseFromPath(int32_t sound_id, const char *file_path)
     }
 
     M_DecodeFrame(stream);
+    error_code = 0;
 
-    const int32_t sdl_sample_rate = stream->av.codec_ctx->sample_rate;
-    const int32_t sdl_channels = stream->av.codec_ctx->ch_layout.nb_channels;
-
-    stream->is_read_done = false;
-    stream->is_used = true;
-    stream->is_playing = true;
-    stream->is_looped = false;
-    stream->volume = 1.0f;
-    stream->timestamp = 0.0;
-    stream->finish_callback = nullptr;
-    stream->finish_callback_user_data = nullptr;
-    stream->duration =
-        (double)stream->av.format_ctx->duration / (double)AV_TIME_BASE;
-    stream->start_at = -1.0; // negative value means unset
-    stream->stop_at = -1.0; // negative value means unset
+cleanup:
+    if (error_code) {
+        LOG_ERROR(
+            "Error while opening audio %s: %s", full_path,
+            av_err2str(error_code));
+    }
+    return error_code;
+}
 
+// Must be called with the audio device locked.
+static bool M_Start(AUDIO_STREAM_SOUND *const stream, const bool is_playing)
+{
+    const int32_t sdl_channels = stream->av.codec_ctx->ch_layout.nb_channels;
     stream->sdl.stream = SDL_NewAudioStream(
         AUDIO_WORKING_FORMAT, sdl_channels, AUDIO_WORKING_RATE,
         AUDIO_WORKING_FORMAT, sdl_channels, AUDIO_WORKING_RATE);
     if (!stream->sdl.stream) {
         LOG_ERROR("Failed to create SDL stream: %s", SDL_GetError());
-        goto cleanup;
+        return false;
     }
 
-    ret = true;
+    stream->duration =
+        (double)stream->av.format_ctx->duration / (double)AV_TIME_BASE;
+    stream->is_read_done = false;
+    stream->is_playing = is_playing;
     M_EnqueueFrame(stream);
+    return true;
+}
 
-cleanup:
-    if (error_code) {
-        LOG_ERROR(
-            "Error while opening audio %s: %s", file_path,
-            av_err2str(error_code));
+static bool M_InitialiseFromPath(int32_t sound_id, const char *file_path)
+{
+    ASSERT(file_path != nullptr);
+
+    if (!g_AudioDeviceID || sound_id < 0
+        || sound_id >= AUDIO_MAX_ACTIVE_STREAMS) {
+        return false;
+    }
+
+    bool ret = false;
+    char *full_path = File_GetFullPath(file_path);
+    AUDIO_STREAM_SOUND *const stream = &m_Streams[sound_id];
+
+    if (M_Open(stream, full_path) == 0) {
+        SDL_LockAudioDevice(g_AudioDeviceID);
+        ret = M_Start(stream, true);
+        SDL_UnlockAudioDevice(g_AudioDeviceID);
     }
 
     if (!ret) {
-        Audio_Stream_Close(sound_id);
+        M_Close(sound_id);
     }
 
-    SDL_UnlockAudioDevice(g_AudioDeviceID);
     Memory_FreePointer(&full_path);
     return ret;
 }
 
+static int M_LoadThread(void *const arg)
+{
+    const int32_t sound_id = (int32_t)(intptr_t)arg;
+    AUDIO_STREAM_SOUND *const stream = &m_Streams[sound_id];
+    const int32_t error_code = M_Open(stream, stream->load_path);
+
+    SDL_LockAudioDevice(g_AudioDeviceID);
+    const bool ret =
+        error_code == 0 && M_Start(stream, !stream->is_load_paused);
+    if (!ret) {
+        // Leave closing the slot to the mixer or the owner, as the finish
+        // callback may not be set up yet.
+        M_FreeResources(stream);
+        stream->is_load_failed = true;
+    }
+    Memory_FreePointer(&stream->load_path);
+    stream->is_loading = false;
+    SDL_UnlockAudioDevice(g_AudioDeviceID);
+    return 0;
+}
+
+static void M_WaitForLoad(const AUDIO_STREAM_SOUND *const stream)
+{
+    while (true) {
+        SDL_LockAudioDevice(g_AudioDeviceID);
+        const bool is_loading = stream->is_loading;
+        SDL_UnlockAudioDevice(g_AudioDeviceID);
+        if (!is_loading) {
+            return;
+        }
+        SDL_Delay(1);
+    }
+}
+
+static void M_FreeResources(AUDIO_STREAM_SOUND *const stream)
+{
+    if (stream->av.codec_ctx) {
+        // XXX: potential libav bug - avcodec_close should free this info
+        if (stream->av.codec_ctx->extradata != nullptr) {
+            av_freep(&stream->av.codec_ctx->extradata);
+        }
+
+        avcodec_free_context(&stream->av.codec_ctx);
+        stream->av.codec_ctx = nullptr;
+    }
+
+    if (stream->av.format_ctx) {
+        avformat_close_input(&stream->av.format_ctx);
+        stream->av.format_ctx = nullptr;
+    }
+
+    if (stream->swr.ctx) {
+        swr_free(&stream->swr.ctx);
+    }
+
+    if (stream->av.frame) {
+        av_frame_free(&stream->av.frame);
+        stream->av.frame = nullptr;
+    }
+
+    if (stream->av.packet) {
+        av_packet_free(&stream->av.packet);
+        stream->av.packet = nullptr;
+    }
+
+    stream->av.stream = nullptr;
+    stream->av.codec = nullptr;
+
+    if (stream->sdl.stream) {
+        SDL_FreeAudioStream(stream->sdl.stream);
+        stream->sdl.stream = nullptr;
+    }
+
+    Memory_FreePointer(&stream->decode.buffer);
+    stream->decode.capacity = 0;
+}
+
+static bool M_Close(const int32_t sound_id)
+{
+    if (!g_AudioDeviceID || sound_id < 0
+        || sound_id >= AUDIO_MAX_ACTIVE_STREAMS) {
+        return false;
+    }
+
+    SDL_LockAudioDevice(g_AudioDeviceID);
+
+    AUDIO_STREAM_SOUND *stream = &m_Streams[sound_id];
+    M_FreeResources(stream);
+
+    void (*finish_callback)(int32_t, void *) = stream->finish_callback;
+    void *finish_callback_user_data = stream->finish_callback_user_data;
+
+    M_Clear(stream);
+
+    SDL_UnlockAudioDevice(g_AudioDeviceID);
+
+    if (finish_callback) {
+        finish_callback(sound_id, finish_callback_user_data);
+    }
+
+    return true;
+}
+
 static void M_Clear(AUDIO_STREAM_SOUND *stream)
 {
     ASSERT(stream != nullptr);
@@ -373,6 +539,9 @@ static void M_Clear(AUDIO_STREAM_SOUND *stream)
     stream->is_playing = false;
     stream->is_read_done = true;
     stream->is_looped = false;
+    stream->is_loading = false;
+    stream->is_load_paused = false;
+    stream->is_load_failed = false;
     stream->volume = 0.0f;
     stream->duration = 0.0;
     stream->timestamp = 0.0;
@@ -391,8 +560,6 @@ void Audio_Stream_Init(void)
 
 void Audio_Stream_Shutdown(void)
 {
-    Memory_FreePointer(&m_DecodeBuffer);
-    m_DecodeBufferCapacity = 0;
     if (!g_AudioDeviceID) {
         return;
     }
@@ -412,11 +579,14 @@ bool Audio_Stream_Pause(int32_t sound_id)
         return false;
     }
 
-    if (m_Streams[sound_id].is_playing) {
-        SDL_LockAudioDevice(g_AudioDeviceID);
-        m_Streams[sound_id].is_playing = false;
-        SDL_UnlockAudioDevice(g_AudioDeviceID);
+    AUDIO_STREAM_SOUND *const stream = &m_Streams[sound_id];
+    SDL_LockAudioDevice(g_AudioDeviceID);
+    if (stream->is_loading) {
+        stream->is_load_paused = true;
+    } else {
+        stream->is_playing = false;
     }
+    SDL_UnlockAudioDevice(g_AudioDeviceID);
 
     return true;
 }
@@ -428,11 +598,14 @@ bool Audio_Stream_Unpause(int32_t sound_id)
         return false;
     }
 
-    if (!m_Streams[sound_id].is_playing) {
-        SDL_LockAudioDevice(g_AudioDeviceID);
-        m_Streams[sound_id].is_playing = true;
-        SDL_UnlockAudioDevice(g_AudioDeviceID);
+    AUDIO_STREAM_SOUND *const stream = &m_Streams[sound_id];
+    SDL_LockAudioDevice(g_AudioDeviceID);
+    if (stream->is_loading) {
+        stream->is_load_paused = false;
+    } else if (stream->sdl.stream != nullptr) {
+        stream->is_playing = true;
     }
+    SDL_UnlockAudioDevice(g_AudioDeviceID);
 
     return true;
 }
@@ -445,82 +618,73 @@ int32_t Audio_Stream_CreateFromFile(const char *file_path)
 
     ASSERT(file_path != nullptr);
 
-    for (int32_t sound_id = 0; sound_id < AUDIO_MAX_ACTIVE_STREAMS;
-         sound_id++) {
-        AUDIO_STREAM_SOUND *stream = &m_Streams[sound_id];
-        if (stream->is_used) {
-            continue;
-        }
-
-        if (!M_InitialiseFromPath(sound_id, file_path)) {
-            return AUDIO_NO_SOUND;
-        }
+    const int32_t sound_id = M_Reserve();
+    if (sound_id == AUDIO_NO_SOUND) {
+        return AUDIO_NO_SOUND;
+    }
 
-        return sound_id;
+    if (!M_InitialiseFromPath(sound_id, file_path)) {
+        return AUDIO_NO_SOUND;
     }
 
-    return AUDIO_NO_SOUND;
+    return sound_id;
 }
 
-bool Audio_Stream_Close(int32_t sound_id)
+int32_t Audio_Stream_CreateFromFileAsync(
+    const char *const file_path, const bool is_paused)
 {
-    if (!g_AudioDeviceID || sound_id < 0
-        || sound_id >= AUDIO_MAX_ACTIVE_STREAMS) {
-        return false;
-    }
-
-    SDL_LockAudioDevice(g_AudioDeviceID);
-
-    AUDIO_STREAM_SOUND *stream = &m_Streams[sound_id];
-
-    if (stream->av.codec_ctx) {
-        // XXX: potential libav bug - avcodec_close should free this info
-        if (stream->av.codec_ctx->extradata != nullptr) {
-            av_freep(&stream->av.codec_ctx->extradata);
-        }
-
-        avcodec_free_context(&stream->av.codec_ctx);
-        stream->av.codec_ctx = nullptr;
+    if (!g_AudioDeviceID) {
+        return AUDIO_NO_SOUND;
     }
 
-    if (stream->av.format_ctx) {
-        avformat_close_input(&stream->av.format_ctx);
-        stream->av.format_ctx = nullptr;
-    }
+    ASSERT(file_path != nullptr);
 
-    if (stream->swr.ctx) {
-        swr_free(&stream->swr.ctx);
+    const int32_t sound_id = M_Reserve();
+    if (sound_id == AUDIO_NO_SOUND) {
+        return AUDIO_NO_SOUND;
     }
 
-    if (stream->av.frame) {
-        av_frame_free(&stream->av.frame);
-        stream->av.frame = nullptr;
-    }
+    AUDIO_STREAM_SOUND *const stream = &m_Streams[sound_id];
+    stream->load_path = File_GetFullPath(file_path);
+    stream->is_loading = true;
+    stream->is_load_paused = is_paused;
 
-    if (stream->av.packet) {
-        av_packet_free(&stream->av.packet);
-        stream->av.packet = nullptr;
+    SDL_Thread *const thread = SDL_CreateThread(
+        M_LoadThread, "audio_stream_load", (void *)(intptr_t)sound_id);
+    if (thread == nullptr) {
+        LOG_ERROR("SDL_CreateThread(): %s", SDL_GetError());
+        stream->is_loading = false;
+        Memory_FreePointer(&stream->load_path);
+        M_Close(sound_id);
+        return AUDIO_NO_SOUND;
     }
 
-    stream->av.stream = nullptr;
-    stream->av.codec = nullptr;
+    SDL_DetachThread(thread);
+    return sound_id;
+}
 
-    if (stream->sdl.stream) {
-        SDL_FreeAudioStream(stream->sdl.stream);
+bool Audio_Stream_IsLoadFailed(const int32_t sound_id)
+{
+    if (!g_AudioDeviceID || sound_id < 0
+        || sound_id >= AUDIO_MAX_ACTIVE_STREAMS) {
+        return false;
     }
 
-    void (*finish_callback)(int32_t, void *) = stream->finish_callback;
-    void *finish_callback_user_data = stream->finish_callback_user_data;
-
-    M_Clear(stream);
-
+    SDL_LockAudioDevice(g_AudioDeviceID);
+    const bool is_load_failed = m_Streams[sound_id].is_load_failed;
     SDL_UnlockAudioDevice(g_AudioDeviceID);
+    return is_load_failed;
+}
 
-    if (finish_callback) {
-        finish_callback(sound_id, finish_callback_user_data);
+bool Audio_Stream_Close(int32_t sound_id)
+{
+    if (!g_AudioDeviceID || sound_id < 0
+        || sound_id >= AUDIO_MAX_ACTIVE_STREAMS) {
+        return false;
     }
 
-    return true;
+    M_WaitForLoad(&m_Streams[sound_id]);
+    return M_Close(sound_id);
 }
 
 bool Audio_Stream_SetVolume(int32_t sound_id, float volume)
@@ -577,6 +741,14 @@ void Audio_Stream_Mix(float *dst_buffer, size_t len)
     for (int32_t sound_id = 0; sound_id < AUDIO_MAX_ACTIVE_STREAMS;
          sound_id++) {
         AUDIO_STREAM_SOUND *stream = &m_Streams[sound_id];
+        if (stream->is_load_failed) {
+            // Without a callback nobody would learn that the slot went away,
+            // so it stays reserved until the owner closes it.
+            if (stream->finish_callback != nullptr) {
+                M_Close(sound_id);
+            }
+            continue;
+        }
         if (!stream->is_playing) {
             continue;
         }
@@ -642,7 +814,7 @@ void Audio_Stream_Mix(float *dst_buffer, size_t len)
         }
 
         if (!stream->is_used) {
-            Audio_Stream_Close(sound_id);
+            M_Close(sound_id);
         }
     }
 }
@@ -687,6 +859,7 @@ bool Audio_Stream_SeekTimestamp(int32_t sound_id, double timestamp)
         return false;
     }
 
+    M_WaitForLoad(&m_Streams[sound_id]);
     if (m_Streams[sound_id].is_playing) {
         SDL_LockAudioDevice(g_AudioDeviceID);
         AUDIO_STREAM_SOUND *stream = &m_Streams[sound_id];
@@ -10,18 +10,40 @@
 #include <dirent.h>
 #include <stdio.h>
 #include <string.h>
+#include <sys/stat.h>
 
 #if defined(_WIN32)
     #include <direct.h>
+    #include <io.h>
+    #include <windows.h>
     #define PATH_SEPARATOR "\\"
 #else
-    #include <sys/stat.h>
+    #include <unistd.h>
     #define PATH_SEPARATOR "/"
 #endif
 
+#define TEMP_FILE_SUFFIX ".tmp"
+#define MEMORY_FILE_MIN_CAPACITY 4096
+#define FILE_BUFFER_SIZE 65536
+
 struct MYFILE {
     FILE *fp;
     const char *path;
+    bool has_error;
+    // Memory files have no fp and keep their contents here instead.
+    char *data;
+    size_t size;
+    size_t capacity;
+    size_t pos;
+    // Disk files are buffered here rather than by stdio, so that the small
+    // typed reads and writes that make up most of the traffic cost a memcpy.
+    // The buffer holds either bytes read ahead of buf_pos, or pending writes
+    // before it, and buf_start is the file offset of its first byte.
+    char *buf;
+    size_t buf_start;
+    size_t buf_pos;
+    size_t buf_len;
+    bool buf_is_dirty;
 };
 
 const char *m_GameDir = nullptr;
@@ -30,6 +52,13 @@ static void M_PathAppendSeparator(char *path);
 static void M_PathAppendPart(char *path, const char *part);
 static char *M_CasePath(char const *path);
 static bool M_ExistsRaw(const char *path);
+static bool M_SyncRaw(FILE *fp);
+static bool M_ReplaceRaw(const char *src_path, const char *dst_path);
+static void M_ReserveMemory(MYFILE *file, size_t size);
+static void M_WriteRaw(MYFILE *file, const void *data, size_t size);
+static void M_FlushBuffer(MYFILE *file);
+static void M_Read(MYFILE *file, void *data, size_t size);
+static void M_Write(MYFILE *file, const void *data, size_t size);
 
 static void M_PathAppendSeparator(char *path)
 {
@@ -127,6 +156,95 @@ static bool M_ExistsRaw(const char *path)
     return false;
 }
 
+static bool M_SyncRaw(FILE *const fp)
+{
+    if (fflush(fp) != 0) {
+        return false;
+    }
+#if defined(_WIN32)
+    return _commit(_fileno(fp)) == 0;
+#else
+    return fsync(fileno(fp)) == 0;
+#endif
+}
+
+static bool M_ReplaceRaw(const char *const src_path, const char *const dst_path)
+{
+#if defined(_WIN32)
+    // rename() refuses to overwrite existing files on Windows.
+    return MoveFileExA(
+               src_path, dst_path,
+               MOVEFILE_REPLACE_EXISTING | MOVEFILE_WRITE_THROUGH)
+        != 0;
+#else
+    return rename(src_path, dst_path) == 0;
+#endif
+}
+
+static void M_ReserveMemory(MYFILE *const file, const size_t size)
+{
+    if (size <= file->capacity) {
+        return;
+    }
+    size_t capacity = MAX(file->capacity * 2, size);
+    capacity = MAX(capacity, (size_t)MEMORY_FILE_MIN_CAPACITY);
+    file->data = Memory_Realloc(file->data, capacity);
+    file->capacity = capacity;
+}
+
+static void M_WriteRaw(
+    MYFILE *const file, const void *const data, const size_t size)
+{
+    if (fwrite(data, 1, size, file->fp) != size) {
+        file->has_error = true;
+    }
+    // Switching from writing to reading needs a flush in between.
+    fflush(file->fp);
+    file->buf_start += size;
+}
+
+static void M_FlushBuffer(MYFILE *const file)
+{
+    if (file->buf_is_dirty) {
+        const size_t size = file->buf_pos;
+        file->buf_pos = 0;
+        file->buf_is_dirty = false;
+        M_WriteRaw(file, file->buf, size);
+        return;
+    }
+
+    // Give back the bytes that were read ahead. The seek is also what allows
+    // writing after reading.
+    file->buf_start += file->buf_pos;
+    file->buf_pos = 0;
+    file->buf_len = 0;
+    if (fseek(file->fp, file->buf_start, SEEK_SET) != 0) {
+        file->has_error = true;
+    }
+}
+
+static void M_Read(MYFILE *const file, void *const data, const size_t size)
+{
+    if (file->fp != nullptr && !file->buf_is_dirty
+        && file->buf_len - file->buf_pos >= size) {
+        memcpy(data, file->buf + file->buf_pos, size);
+        file->buf_pos += size;
+        return;
+    }
+    File_ReadData(file, data, size);
+}
+
+static void M_Write(
+    MYFILE *const file, const void *const data, const size_t size)
+{
+    if (file->buf_is_dirty && file->buf_pos + size <= FILE_BUFFER_SIZE) {
+        memcpy(file->buf + file->buf_pos, data, size);
+        file->buf_pos += size;
+        return;
+    }
+    File_WriteData(file, data, size);
+}
+
 bool File_IsAbsolute(const char *path)
 {
     return path && (path[0] == '/' || strstr(path, ":\\"));
@@ -256,104 +374,175 @@ MYFILE *File_Open(const char *path, FILE_OPEN_MODE mode)
     if (!file->fp) {
         Memory_FreePointer(&file->path);
         Memory_FreePointer(&file);
+        return nullptr;
     }
+    setvbuf(file->fp, nullptr, _IONBF, 0);
+    file->buf = Memory_Alloc(FILE_BUFFER_SIZE);
+    return file;
+}
+
+MYFILE *File_OpenMemory(void)
+{
+    MYFILE *const file = Memory_Alloc(sizeof(MYFILE));
+    file->path = Memory_DupStr("");
     return file;
 }
 
 void File_ReadData(MYFILE *const file, void *const data, const size_t size)
 {
-    fread(data, size, 1, file->fp);
+    char *out = data;
+    size_t remaining = size;
+
+    if (file->fp == nullptr) {
+        const size_t avail_size = file->pos < file->size
+            ? file->size - file->pos
+            : 0;
+        const size_t read_size = MIN(size, avail_size);
+        memcpy(out, file->data + file->pos, read_size);
+        file->pos += read_size;
+        out += read_size;
+        remaining -= read_size;
+    }
+
+    while (file->fp != nullptr && remaining > 0) {
+        if (file->buf_is_dirty || file->buf_pos == file->buf_len) {
+            M_FlushBuffer(file);
+            if (remaining >= FILE_BUFFER_SIZE) {
+                // Large reads go straight to the destination.
+                const size_t read_size = fread(out, 1, remaining, file->fp);
+                file->buf_start += read_size;
+                out += read_size;
+                remaining -= read_size;
+                break;
+            }
+            file->buf_len = fread(file->buf, 1, FILE_BUFFER_SIZE, file->fp);
+            if (file->buf_len == 0) {
+                break;
+            }
+        }
+
+        const size_t read_size =
+            MIN(remaining, file->buf_len - file->buf_pos);
+        memcpy(out, file->buf + file->buf_pos, read_size);
+        file->buf_pos += read_size;
+        out += read_size;
+        remaining -= read_size;
+    }
+
+    if (remaining > 0) {
+        file->has_error = true;
+        memset(out, 0, remaining);
+    }
 }
 
 void File_ReadItems(
     MYFILE *const file, void *data, const size_t count, const size_t item_size)
 {
-    fread(data, item_size, count, file->fp);
+    File_ReadData(file, data, count * item_size);
 }
 
 int8_t File_ReadS8(MYFILE *const file)
 {
-    int8_t result;
-    fread(&result, sizeof(result), 1, file->fp);
-    return result;
+    return (int8_t)File_ReadU8(file);
 }
 
 int16_t File_ReadS16(MYFILE *const file)
 {
-    int16_t result;
-    fread(&result, sizeof(result), 1, file->fp);
-    return result;
+    return (int16_t)File_ReadU16(file);
 }
 
 int32_t File_ReadS32(MYFILE *const file)
 {
-    int32_t result;
-    fread(&result, sizeof(result), 1, file->fp);
-    return result;
+    return (int32_t)File_ReadU32(file);
 }
 
 uint8_t File_ReadU8(MYFILE *const file)
 {
     uint8_t result;
-    fread(&result, sizeof(result), 1, file->fp);
+    M_Read(file, &result, sizeof(result));
     return result;
 }
 
 uint16_t File_ReadU16(MYFILE *const file)
 {
-    uint16_t result;
-    fread(&result, sizeof(result), 1, file->fp);
-    return result;
+    uint8_t bytes[2];
+    M_Read(file, bytes, sizeof(bytes));
+    return bytes[0] | (bytes[1] << 8);
 }
 
 uint32_t File_ReadU32(MYFILE *const file)
 {
-    uint32_t result;
-    fread(&result, sizeof(result), 1, file->fp);
-    return result;
+    uint8_t bytes[4];
+    M_Read(file, bytes, sizeof(bytes));
+    return bytes[0] | (bytes[1] << 8) | (bytes[2] << 16)
+        | ((uint32_t)bytes[3] << 24);
 }
 
 void File_WriteData(
     MYFILE *const file, const void *const data, const size_t size)
 {
-    fwrite(data, size, 1, file->fp);
+    if (file->fp == nullptr) {
+        M_ReserveMemory(file, file->pos + size);
+        memcpy(file->data + file->pos, data, size);
+        file->pos += size;
+        file->size = MAX(file->size, file->pos);
+        return;
+    }
+
+    if (!file->buf_is_dirty || file->buf_pos + size > FILE_BUFFER_SIZE) {
+        M_FlushBuffer(file);
+        if (size >= FILE_BUFFER_SIZE) {
+            M_WriteRaw(file, data, size);
+            return;
+        }
+        file->buf_is_dirty = true;
+    }
+    memcpy(file->buf + file->buf_pos, data, size);
+    file->buf_pos += size;
 }
 
 void File_WriteItems(
     MYFILE *const file, const void *const data, const size_t count,
     const size_t item_size)
 {
-    fwrite(data, item_size, count, file->fp);
+    File_WriteData(file, data, count * item_size);
 }
 
 void File_WriteS8(MYFILE *const file, const int8_t value)
 {
-    fwrite(&value, sizeof(value), 1, file->fp);
+    File_WriteU8(file, (uint8_t)value);
 }
 
 void File_WriteS16(MYFILE *const file, const int16_t value)
 {
-    fwrite(&value, sizeof(value), 1, file->fp);
+    File_WriteU16(file, (uint16_t)value);
 }
 
 void File_WriteS32(MYFILE *const file, const int32_t value)
 {
-    fwrite(&value, sizeof(value), 1, file->fp);
+    File_WriteU32(file, (uint32_t)value);
 }
 
 void File_WriteU8(MYFILE *const file, const uint8_t value)
 {
-    fwrite(&value, sizeof(value), 1, file->fp);
+    M_Write(file, &value, sizeof(value));
 }
 
 void File_WriteU16(MYFILE *const file, const uint16_t value)
 {
-    fwrite(&value, sizeof(value), 1, file->fp);
+    const uint8_t bytes[2] = { value, value >> 8 };
+    M_Write(file, bytes, sizeof(bytes));
 }
 
 void File_WriteU32(MYFILE *const file, const uint32_t value)
 {
-    fwrite(&value, sizeof(value), 1, file->fp);
+    const uint8_t bytes[4] = { value, value >> 8, value >> 16, value >> 24 };
+    M_Write(file, bytes, sizeof(bytes));
+}
+
+bool File_HasError(MYFILE *const file)
+{
+    return file->has_error;
 }
 
 void File_Skip(MYFILE *file, size_t bytes)
@@ -363,30 +552,66 @@ void File_Skip(MYFILE *file, size_t bytes)
 
 void File_Seek(MYFILE *file, size_t pos, FILE_SEEK_MODE mode)
 {
+    if (file->fp == nullptr) {
+        switch (mode) {
+        case FILE_SEEK_SET:
+            file->pos = pos;
+            break;
+        case FILE_SEEK_CUR:
+            file->pos += pos;
+            break;
+        case FILE_SEEK_END:
+            file->pos = file->size + pos;
+            break;
+        }
+        return;
+    }
+
+    size_t target = pos;
     switch (mode) {
     case FILE_SEEK_SET:
-        fseek(file->fp, pos, SEEK_SET);
         break;
     case FILE_SEEK_CUR:
-        fseek(file->fp, pos, SEEK_CUR);
+        target += File_Pos(file);
         break;
     case FILE_SEEK_END:
-        fseek(file->fp, pos, SEEK_END);
+        target += File_Size(file);
         break;
     }
+
+    // Seeking within the bytes read ahead, which is what skipping over
+    // fields usually does, needs no call into stdio.
+    if (!file->buf_is_dirty && target >= file->buf_start
+        && target <= file->buf_start + file->buf_len) {
+        file->buf_pos = target - file->buf_start;
+        return;
+    }
+
+    M_FlushBuffer(file);
+    file->buf_start = target;
+    if (fseek(file->fp, target, SEEK_SET) != 0) {
+        file->has_error = true;
+    }
 }
 
 size_t File_Pos(MYFILE *file)
 {
-    return ftell(file->fp);
+    if (file->fp == nullptr) {
+        return file->pos;
+    }
+    return file->buf_start + file->buf_pos;
 }
 
 size_t File_Size(MYFILE *file)
 {
-    size_t old = ftell(file->fp);
+    if (file->fp == nullptr) {
+        return file->size;
+    }
+    const size_t pos = File_Pos(file);
+    M_FlushBuffer(file);
     fseek(file->fp, 0, SEEK_END);
-    size_t size = ftell(file->fp);
-    fseek(file->fp, old, SEEK_SET);
+    const size_t size = ftell(file->fp);
+    fseek(file->fp, pos, SEEK_SET);
     return size;
 }
 
@@ -397,11 +622,65 @@ const char *File_GetPath(MYFILE *file)
 
 void File_Close(MYFILE *file)
 {
-    fclose(file->fp);
+    if (file->fp != nullptr) {
+        M_FlushBuffer(file);
+        fclose(file->fp);
+    }
+    Memory_FreePointer(&file->buf);
+    Memory_FreePointer(&file->data);
     Memory_FreePointer(&file->path);
     Memory_FreePointer(&file);
 }
 
+void File_CloseMemory(
+    MYFILE *const file, char **const out_data, size_t *const out_size)
+{
+    ASSERT(file->fp == nullptr);
+    *out_data = file->data;
+    *out_size = file->size;
+    file->data = nullptr;
+    File_Close(file);
+}
+
+bool File_WriteAtomic(
+    const char *const path, const void *const data, const size_t size)
+{
+    char *full_path = File_GetFullPath(path);
+    char *temp_path =
+        Memory_Alloc(strlen(full_path) + strlen(TEMP_FILE_SUFFIX) + 1);
+    sprintf(temp_path, "%s" TEMP_FILE_SUFFIX, full_path);
+
+    bool result = false;
+    FILE *const fp = fopen(temp_path, "wb");
+    if (fp == nullptr) {
+        LOG_ERROR("Can't open file %s", temp_path);
+        goto finish;
+    }
+
+    // The data must be on the disk before the rename, or a crash right after
+    // it could leave an empty or partial file in place of the old one.
+    bool is_written = fwrite(data, 1, size, fp) == size && M_SyncRaw(fp);
+    is_written = fclose(fp) == 0 && is_written;
+    if (!is_written) {
+        LOG_ERROR("Can't write file %s", temp_path);
+        remove(temp_path);
+        goto finish;
+    }
+
+    if (!M_ReplaceRaw(temp_path, full_path)) {
+        LOG_ERROR("Can't replace file %s", full_path);
+        remove(temp_path);
+        goto finish;
+    }
+
+    result = true;
+
+finish:
+    Memory_FreePointer(&temp_path);
+    Memory_FreePointer(&full_path);
+    return result;
+}
+
 bool File_Load(const char *path, char **output_data, size_t *output_size)
 {
     ASSERT(output_data != nullptr);
@@ -444,3 +723,77 @@ void File_CreateDirectory(const char *path)
 #endif
     Memory_FreePointer(&full_path);
 }
+
+FILE_LISTING *File_ListDirectory(const char *const path)
+{
+    char *full_path = File_GetFullPath(path);
+    DIR *const dir = opendir(full_path);
+    if (dir == nullptr) {
+        Memory_FreePointer(&full_path);
+        return nullptr;
+    }
+
+    FILE_LISTING *const listing = Memory_Alloc(sizeof(FILE_LISTING));
+    int32_t capacity = 0;
+    char *entry_path = nullptr;
+    size_t entry_path_capacity = 0;
+
+    struct dirent *cur_file;
+    while ((cur_file = readdir(dir)) != nullptr) {
+        const size_t needed =
+            strlen(full_path) + strlen(cur_file->d_name) + 2;
+        if (needed > entry_path_capacity) {
+            entry_path_capacity = needed;
+            entry_path = Memory_Realloc(entry_path, entry_path_capacity);
+        }
+        strcpy(entry_path, full_path);
+        M_PathAppendPart(entry_path, cur_file->d_name);
+
+        struct stat st;
+        if (stat(entry_path, &st) != 0 || !S_ISREG(st.st_mode)) {
+            continue;
+        }
+
+        if (listing->count == capacity) {
+            capacity = MAX(capacity * 2, 16);
+            listing->entries = Memory_Realloc(
+                listing->entries, sizeof(FILE_ENTRY) * capacity);
+        }
+        listing->entries[listing->count++] = (FILE_ENTRY) {
+            .name = Memory_DupStr(cur_file->d_name),
+            .size = st.st_size,
+            .mtime = st.st_mtime,
+        };
+    }
+    closedir(dir);
+
+    Memory_FreePointer(&entry_path);
+    Memory_FreePointer(&full_path);
+    return listing;
+}
+
+void File_FreeListing(FILE_LISTING *const listing)
+{
+    if (listing == nullptr) {
+        return;
+    }
+    for (int32_t i = 0; i < listing->count; i++) {
+        Memory_FreePointer(&listing->entries[i].name);
+    }
+    Memory_FreePointer(&listing->entries);
+    Memory_Free(listing);
+}
+
+const FILE_ENTRY *File_FindEntry(
+    const FILE_LISTING *const listing, const char *const name)
+{
+    if (listing == nullptr) {
+        return nullptr;
+    }
+    for (int32_t i = 0; i < listing->count; i++) {
+        if (String_Equivalent(listing->entries[i].name, name)) {
+            return &listing->entries[i];
+        }
+    }
+    return nullptr;
+}
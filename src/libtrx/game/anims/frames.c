@@ -4,9 +4,11 @@
 #include "game/game_buf.h"
 #include "game/objects/common.h"
 #include "log.h"
+#include "memory.h"
 #include "utils.h"
 
 #include <math.h>
+#include <stdlib.h>
 
 #if TR_VERSION > 1
 typedef enum {
@@ -20,8 +22,11 @@ typedef enum {
 static ANIM_FRAME *m_Frames = nullptr;
 
 static int32_t M_GetAnimFrameCount(int32_t anim_idx, int32_t frame_data_length);
-static OBJECT *M_GetAnimObject(int32_t anim_idx);
-static ANIM_FRAME *M_FindFrameBase(uint32_t frame_ofs);
+static OBJECT **M_MapAnimObjects(int32_t anim_count);
+static int M_CompareAnimOffsets(const void *a, const void *b);
+static int32_t *M_SortAnimsByOffset(int32_t anim_count);
+static ANIM_FRAME *M_FindFrameBase(
+    const int32_t *sorted_anims, int32_t anim_count, uint32_t frame_ofs);
 static int32_t M_ParseFrame(
     ANIM_FRAME *frame, const int16_t *data_ptr, int16_t mesh_count,
     uint8_t frame_size);
@@ -46,23 +51,61 @@ static int32_t M_GetAnimFrameCount(
 #endif
 }
 
-static OBJECT *M_GetAnimObject(const int32_t anim_idx)
+static OBJECT **M_MapAnimObjects(const int32_t anim_count)
 {
-    for (int32_t i = 0; i < O_NUMBER_OF; i++) {
+    // Maps each animation to the first loaded object that starts with it.
+    OBJECT **const anim_objects = Memory_Alloc(sizeof(OBJECT *) * anim_count);
+    for (int32_t i = O_NUMBER_OF - 1; i >= 0; i--) {
         OBJECT *const obj = Object_Get(i);
-        if (obj->loaded && obj->mesh_count >= 0 && obj->anim_idx == anim_idx) {
-            return obj;
+        if (obj->loaded && obj->mesh_count >= 0 && obj->anim_idx >= 0
+            && obj->anim_idx < anim_count) {
+            anim_objects[obj->anim_idx] = obj;
         }
     }
+    return anim_objects;
+}
 
-    return nullptr;
+static int M_CompareAnimOffsets(const void *const a, const void *const b)
+{
+    const int32_t anim_idx_a = *(const int32_t *)a;
+    const int32_t anim_idx_b = *(const int32_t *)b;
+    const uint32_t frame_ofs_a = Anim_GetAnim(anim_idx_a)->frame_ofs;
+    const uint32_t frame_ofs_b = Anim_GetAnim(anim_idx_b)->frame_ofs;
+    if (frame_ofs_a != frame_ofs_b) {
+        return frame_ofs_a < frame_ofs_b ? -1 : 1;
+    }
+    return anim_idx_a - anim_idx_b;
 }
 
-static ANIM_FRAME *M_FindFrameBase(const uint32_t frame_ofs)
+static int32_t *M_SortAnimsByOffset(const int32_t anim_count)
 {
-    const int32_t anim_count = Anim_GetTotalCount();
+    int32_t *const sorted_anims = Memory_Alloc(sizeof(int32_t) * anim_count);
     for (int32_t i = 0; i < anim_count; i++) {
-        const ANIM *const anim = Anim_GetAnim(i);
+        sorted_anims[i] = i;
+    }
+    qsort(sorted_anims, anim_count, sizeof(int32_t), M_CompareAnimOffsets);
+    return sorted_anims;
+}
+
+static ANIM_FRAME *M_FindFrameBase(
+    const int32_t *const sorted_anims, const int32_t anim_count,
+    const uint32_t frame_ofs)
+{
+    // Find the first animation with this offset, so that duplicates resolve
+    // to the lowest index.
+    int32_t lo = 0;
+    int32_t hi = anim_count;
+    while (lo < hi) {
+        const int32_t mid = lo + (hi - lo) / 2;
+        if (Anim_GetAnim(sorted_anims[mid])->frame_ofs < frame_ofs) {
+            lo = mid + 1;
+        } else {
+            hi = mid;
+        }
+    }
+
+    if (lo < anim_count) {
+        const ANIM *const anim = Anim_GetAnim(sorted_anims[lo]);
         if (anim->frame_ofs == frame_ofs) {
             return anim->frame_ptr;
         }
@@ -166,11 +209,12 @@ void Anim_LoadFrames(const int16_t *data, const int32_t data_length)
     BENCHMARK *const benchmark = Benchmark_Start();
 
     const int32_t anim_count = Anim_GetTotalCount();
+    OBJECT **anim_objects = M_MapAnimObjects(anim_count);
     OBJECT *cur_obj = nullptr;
     int32_t frame_idx = 0;
 
     for (int32_t i = 0; i < anim_count; i++) {
-        OBJECT *const next_obj = M_GetAnimObject(i);
+        OBJECT *const next_obj = anim_objects[i];
         const bool obj_changed = next_obj != nullptr;
         if (obj_changed) {
             cur_obj = next_obj;
@@ -199,13 +243,20 @@ void Anim_LoadFrames(const int16_t *data, const int32_t data_length)
 
     // Some OG data contains objects that point to the previous object's frames,
     // so ensure everything that's loaded is configured as such.
+    int32_t *sorted_anims = nullptr;
     for (int32_t i = 0; i < O_NUMBER_OF; i++) {
         OBJECT *const obj = Object_Get(i);
         if (obj->loaded && obj->mesh_count >= 0 && obj->anim_idx == -1
             && obj->frame_base == nullptr) {
-            obj->frame_base = M_FindFrameBase(obj->frame_ofs);
+            if (sorted_anims == nullptr) {
+                sorted_anims = M_SortAnimsByOffset(anim_count);
+            }
+            obj->frame_base =
+                M_FindFrameBase(sorted_anims, anim_count, obj->frame_ofs);
         }
     }
 
+    Memory_FreePointer(&anim_objects);
+    Memory_FreePointer(&sorted_anims);
     Benchmark_End(benchmark, nullptr);
 }
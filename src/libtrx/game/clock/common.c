@@ -3,17 +3,39 @@
 #include "game/clock/const.h"
 #include "game/clock/timer.h"
 #include "game/clock/turbo.h"
+#include "log.h"
+#include "utils.h"
 
 #include <SDL2/SDL_stdinc.h>
 #include <SDL2/SDL_timer.h>
+#include <errno.h>
 #include <stdint.h>
 #include <stdio.h>
+#include <string.h>
 #include <time.h>
 
+#if !defined(_WIN32)
+    #include <sched.h>
+#endif
+
+// The OS sleep is only trusted to wake up the thread somewhere close to the
+// deadline; the last stretch is spent polling the performance counter.
+// Windows sleeps at a millisecond granularity at best, so it needs a wider
+// margin.
+#if defined(_WIN32)
+    #define SPIN_MARGIN_US 2000
+#else
+    #define SPIN_MARGIN_US 1000
+#endif
+
 static Uint64 m_LastCounter = 0;
 static Uint64 m_InitCounter = 0;
 static Uint64 m_Frequency = 0;
 static double m_Accumulator = 0.0;
+static CLOCK_JITTER_STATS m_JitterStats = {};
+static const int32_t m_JitterBucketLimits[CLOCK_JITTER_BUCKET_COUNT - 1] = {
+    50, 100, 250, 500, 1000, 2000, 4000,
+};
 static struct {
     double real_time_at_last_change;
     double sim_time_at_last_change;
@@ -21,12 +43,70 @@ static struct {
 } m_Priv;
 
 static double M_GetHighPrecisionCounter(void);
+static void M_Sleep(Uint64 ticks);
+static void M_Yield(void);
+static void M_WaitUntil(Uint64 deadline);
+static void M_RecordJitter(Uint64 late_ticks);
 
 static double M_GetHighPrecisionCounter(void)
 {
     return (SDL_GetPerformanceCounter() - m_InitCounter) / (double)m_Frequency;
 }
 
+static void M_Sleep(const Uint64 ticks)
+{
+    const double seconds = ticks / (double)m_Frequency;
+#if defined(_WIN32)
+    SDL_Delay((Uint32)(seconds * 1000.0));
+#else
+    const int64_t ns = (int64_t)(seconds * 1000000000.0);
+    struct timespec remaining = {
+        .tv_sec = ns / 1000000000,
+        .tv_nsec = ns % 1000000000,
+    };
+    int result;
+    do {
+        result = nanosleep(&remaining, &remaining);
+    } while (result != 0 && errno == EINTR);
+#endif
+}
+
+static void M_Yield(void)
+{
+#if defined(_WIN32)
+    SDL_Delay(0);
+#else
+    sched_yield();
+#endif
+}
+
+static void M_WaitUntil(const Uint64 deadline)
+{
+    const Uint64 margin = m_Frequency * SPIN_MARGIN_US / 1000000;
+    const Uint64 now = SDL_GetPerformanceCounter();
+    if (now + margin < deadline) {
+        M_Sleep(deadline - margin - now);
+    }
+    while (SDL_GetPerformanceCounter() < deadline) {
+        M_Yield();
+    }
+}
+
+static void M_RecordJitter(const Uint64 late_ticks)
+{
+    const double late_us = late_ticks * 1000000.0 / m_Frequency;
+    int32_t bucket = 0;
+    while (bucket < CLOCK_JITTER_BUCKET_COUNT - 1
+           && late_us >= m_JitterBucketLimits[bucket]) {
+        bucket++;
+    }
+
+    m_JitterStats.buckets[bucket]++;
+    m_JitterStats.frames++;
+    m_JitterStats.total_us += late_us;
+    m_JitterStats.max_us = MAX(m_JitterStats.max_us, late_us);
+}
+
 void Clock_Init(void)
 {
     m_Frequency = SDL_GetPerformanceFrequency();
@@ -47,7 +127,9 @@ size_t Clock_GetDateTime(char *const buffer, const size_t size)
 
 int32_t Clock_GetFrameAdvance(void)
 {
-    return Clock_GetCurrentFPS() == 30 ? 2 : 1;
+    // Measured in 60 FPS frames; rates above that cannot advance by less
+    // than a single frame.
+    return MAX((LOGIC_FPS * 2) / Clock_GetCurrentFPS(), 1);
 }
 
 void Clock_SyncTick(void)
@@ -82,18 +164,15 @@ int32_t Clock_WaitTick(void)
     int32_t frames = (int32_t)(m_Accumulator / frame_ticks);
 
     if (frames < 1) {
-        // Not enough accumulated time for even one frame
-
-        // Calculate how long we should wait (in ms) to hit the frame boundary
-        double needed = frame_ticks - m_Accumulator;
-        double delay_ms = (needed / m_Frequency) * 1000.0;
-
-        if (delay_ms > 0) {
-            SDL_Delay((Uint32)delay_ms);
-        }
+        // Not enough accumulated time for even one frame, so wait until the
+        // exact frame boundary.
+        const Uint64 deadline =
+            current_counter + (Uint64)(frame_ticks - m_Accumulator);
+        M_WaitUntil(deadline);
 
         // After waiting, measure again to be accurate
         const Uint64 after_delay_counter = SDL_GetPerformanceCounter();
+        M_RecordJitter(after_delay_counter - deadline);
         const double after_delay_elapsed =
             (double)(after_delay_counter - current_counter);
         m_Accumulator += after_delay_elapsed;
@@ -116,6 +195,35 @@ int32_t Clock_WaitTick(void)
     return frames;
 }
 
+const CLOCK_JITTER_STATS *Clock_GetJitterStats(void)
+{
+    return &m_JitterStats;
+}
+
+void Clock_ResetJitterStats(void)
+{
+    memset(&m_JitterStats, 0, sizeof(m_JitterStats));
+}
+
+void Clock_DumpJitterStats(void)
+{
+    if (m_JitterStats.frames == 0) {
+        return;
+    }
+
+    char buckets[CLOCK_JITTER_BUCKET_COUNT * 12] = {};
+    size_t pos = 0;
+    for (int32_t i = 0; i < CLOCK_JITTER_BUCKET_COUNT; i++) {
+        pos += snprintf(
+            &buckets[pos], sizeof(buckets) - pos, "%s%d", i ? " " : "",
+            m_JitterStats.buckets[i]);
+    }
+    LOG_DEBUG(
+        "frames: %d, mean late: %.0f us, max late: %.0f us, histogram: %s",
+        m_JitterStats.frames, m_JitterStats.total_us / m_JitterStats.frames,
+        m_JitterStats.max_us, buckets);
+}
+
 double Clock_GetRealTime(void)
 {
     return M_GetHighPrecisionCounter();
@@ -182,7 +182,7 @@ bool Console_Cmd_Config_SetCurrentValue(
 
 const CONFIG_OPTION *Console_Cmd_Config_GetOptionFromKey(const char *const key)
 {
-    VECTOR *source = Vector_Create(sizeof(STRING_FUZZY_SOURCE));
+    STRING_FUZZY_SOURCE_VECTOR source = {};
 
     for (const CONFIG_OPTION *option = Config_GetOptionMap();
          option->name != nullptr; option++) {
@@ -191,33 +191,31 @@ const CONFIG_OPTION *Console_Cmd_Config_GetOptionFromKey(const char *const key)
             .value = (void *)option,
             .weight = 1,
         };
-        Vector_Add(source, &source_item);
+        STRING_FUZZY_SOURCE_Vector_Push(&source, source_item);
     }
 
-    VECTOR *matches = String_FuzzyMatch(key, source);
+    STRING_FUZZY_MATCH_VECTOR matches = String_FuzzyMatch(key, &source);
     const CONFIG_OPTION *result = nullptr;
-    if (matches->count == 0) {
+    if (matches.count == 0) {
         Console_Log(GS(OSD_CONFIG_OPTION_UNKNOWN_OPTION), key);
-    } else if (matches->count == 1) {
-        const STRING_FUZZY_MATCH *const match = Vector_Get(matches, 0);
-        result = match->value;
-    } else if (matches->count == 2) {
-        const STRING_FUZZY_MATCH *const match1 = Vector_Get(matches, 0);
-        const STRING_FUZZY_MATCH *const match2 = Vector_Get(matches, 1);
+    } else if (matches.count == 1) {
+        result = matches.items[0].value;
+    } else if (matches.count == 2) {
+        const STRING_FUZZY_MATCH *const match1 = &matches.items[0];
+        const STRING_FUZZY_MATCH *const match2 = &matches.items[1];
         Console_Log(GS(OSD_AMBIGUOUS_INPUT_2), match1->key, match2->key);
-    } else if (matches->count >= 3) {
-        const STRING_FUZZY_MATCH *const match1 = Vector_Get(matches, 0);
-        const STRING_FUZZY_MATCH *const match2 = Vector_Get(matches, 1);
+    } else if (matches.count >= 3) {
+        const STRING_FUZZY_MATCH *const match1 = &matches.items[0];
+        const STRING_FUZZY_MATCH *const match2 = &matches.items[1];
         Console_Log(GS(OSD_AMBIGUOUS_INPUT_3), match1->key, match2->key);
     }
 
-    for (int32_t i = 0; i < source->count; i++) {
-        const STRING_FUZZY_SOURCE *const source_item = Vector_Get(source, i);
-        Memory_Free((char *)source_item->key);
+    for (int32_t i = 0; i < source.count; i++) {
+        Memory_Free((char *)source.items[i].key);
     }
 
-    Vector_Free(matches);
-    Vector_Free(source);
+    STRING_FUZZY_MATCH_Vector_Free(&matches);
+    STRING_FUZZY_SOURCE_Vector_Free(&source);
     return result;
 }
 
@@ -0,0 +1,28 @@
+#include "game/console/common.h"
+#include "game/console/registry.h"
+#include "game/game_buf.h"
+#include "game/game_string.h"
+#include "memory.h"
+#include "strings.h"
+
+static COMMAND_RESULT M_Entrypoint(const COMMAND_CONTEXT *ctx);
+
+static COMMAND_RESULT M_Entrypoint(const COMMAND_CONTEXT *const ctx)
+{
+    if (!String_IsEmpty(ctx->args)) {
+        return CR_BAD_INVOCATION;
+    }
+
+    GameBuf_DumpStats();
+    Console_Log(
+        GS(OSD_MEMORY_GET), (int32_t)(GameBuf_GetTotalBytes() / 1024),
+        (int32_t)(GameBuf_GetTotalPeakBytes() / 1024));
+
+    const MEMORY_FRAME_STATS *const frame_stats = Memory_GetFrameStats();
+    Console_Log(
+        GS(OSD_MEMORY_FRAME_GET), frame_stats->allocs,
+        frame_stats->peak_allocs, (int32_t)(frame_stats->peak_bytes / 1024));
+    return CR_SUCCESS;
+}
+
+REGISTER_CONSOLE_COMMAND("memory", M_Entrypoint)
@@ -0,0 +1,25 @@
+#include "game/clock.h"
+#include "game/console/common.h"
+#include "game/console/registry.h"
+#include "game/game_string.h"
+#include "strings.h"
+
+static COMMAND_RESULT M_Entrypoint(const COMMAND_CONTEXT *ctx);
+
+static COMMAND_RESULT M_Entrypoint(const COMMAND_CONTEXT *const ctx)
+{
+    if (!String_IsEmpty(ctx->args)) {
+        return CR_BAD_INVOCATION;
+    }
+
+    const CLOCK_JITTER_STATS *const stats = Clock_GetJitterStats();
+    const int32_t mean_us =
+        stats->frames > 0 ? stats->total_us / stats->frames : 0;
+    Console_Log(
+        GS(OSD_PACING_GET), stats->frames, mean_us, (int32_t)stats->max_us);
+    Clock_DumpJitterStats();
+    Clock_ResetJitterStats();
+    return CR_SUCCESS;
+}
+
+REGISTER_CONSOLE_COMMAND("pacing", M_Entrypoint)
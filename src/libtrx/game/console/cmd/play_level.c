@@ -12,8 +12,8 @@ static COMMAND_RESULT M_Entrypoint(const COMMAND_CONTEXT *const ctx)
         return CR_BAD_INVOCATION;
     }
 
-    VECTOR *source = nullptr;
-    VECTOR *matches = nullptr;
+    STRING_FUZZY_SOURCE_VECTOR source = {};
+    STRING_FUZZY_MATCH_VECTOR matches = {};
     int32_t level_to_load = -1;
     const GF_LEVEL_TABLE *const level_table = GF_GetLevelTable(GFLT_MAIN);
 
@@ -21,7 +21,6 @@ static COMMAND_RESULT M_Entrypoint(const COMMAND_CONTEXT *const ctx)
         goto matched;
     }
 
-    source = Vector_Create(sizeof(STRING_FUZZY_SOURCE));
     for (int32_t i = 0; i < level_table->count; i++) {
         STRING_FUZZY_SOURCE source_item = {
             .key = level_table->levels[i].title,
@@ -29,7 +28,7 @@ static COMMAND_RESULT M_Entrypoint(const COMMAND_CONTEXT *const ctx)
             .weight = 1,
         };
         if (source_item.key != nullptr) {
-            Vector_Add(source, &source_item);
+            STRING_FUZZY_SOURCE_Vector_Push(&source, source_item);
         }
     }
 
@@ -40,19 +39,18 @@ static COMMAND_RESULT M_Entrypoint(const COMMAND_CONTEXT *const ctx)
             .value = (void *)(intptr_t)gym_level->num,
             .weight = 1,
         };
-        Vector_Add(source, &source_item);
+        STRING_FUZZY_SOURCE_Vector_Push(&source, source_item);
     }
 
     COMMAND_RESULT result;
-    matches = String_FuzzyMatch(ctx->args, source);
+    matches = String_FuzzyMatch(ctx->args, &source);
 
-    if (matches->count == 0) {
+    if (matches.count == 0) {
         Console_Log(GS(OSD_INVALID_LEVEL));
         result = CR_FAILURE;
         goto cleanup;
-    } else if (matches->count >= 1) {
-        const STRING_FUZZY_MATCH *const match = Vector_Get(matches, 0);
-        level_to_load = (int32_t)(intptr_t)match->value;
+    } else if (matches.count >= 1) {
+        level_to_load = (int32_t)(intptr_t)matches.items[0].value;
         goto matched;
     }
 
@@ -71,14 +69,8 @@ matched:
     }
 
 cleanup:
-    if (matches != nullptr) {
-        Vector_Free(matches);
-        matches = nullptr;
-    }
-    if (source != nullptr) {
-        Vector_Free(source);
-        source = nullptr;
-    }
+    STRING_FUZZY_MATCH_Vector_Free(&matches);
+    STRING_FUZZY_SOURCE_Vector_Free(&source);
 
     return result;
 }
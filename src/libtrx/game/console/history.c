@@ -2,12 +2,15 @@
 
 #include "config/file.h"
 #include "memory.h"
+#include "typed_vector.h"
 #include "utils.h"
-#include "vector.h"
 
 #define MAX_HISTORY_ENTRIES 30
 
-VECTOR *m_History = nullptr;
+// The history is capped, so it never needs to leave the inline storage.
+DECLARE_SMALL_VECTOR(HISTORY_ENTRY, char *, MAX_HISTORY_ENTRIES)
+
+static HISTORY_ENTRY_VECTOR m_History = {};
 static const char *m_Path = "cfg/" PROJECT_NAME "_console_history.json5";
 
 void M_LoadFromJSON(JSON_OBJECT *const root_obj)
@@ -45,7 +48,7 @@ void M_DumpToJSON(JSON_OBJECT *const root_obj)
 
 void Console_History_Init(void)
 {
-    m_History = Vector_Create(sizeof(char *));
+    HISTORY_ENTRY_Vector_Init(&m_History);
     ConfigFile_Read(&(CONFIG_IO_ARGS) {
         .default_path = m_Path,
         .enforced_path = nullptr,
@@ -55,51 +58,46 @@ void Console_History_Init(void)
 
 void Console_History_Shutdown(void)
 {
-    if (m_History != nullptr) {
+    if (m_History.items != nullptr) {
         ConfigFile_Write(&(CONFIG_IO_ARGS) {
             .default_path = m_Path,
             .enforced_path = nullptr,
             .action = &M_DumpToJSON,
         });
-        for (int32_t i = m_History->count - 1; i >= 0; i--) {
-            char *const prompt = *(char **)Vector_Get(m_History, i);
-            Memory_Free(prompt);
+        for (int32_t i = m_History.count - 1; i >= 0; i--) {
+            Memory_Free(m_History.items[i]);
         }
-        Vector_Free(m_History);
-        m_History = nullptr;
+        HISTORY_ENTRY_Vector_Free(&m_History);
+        m_History.items = nullptr;
     }
 }
 
 int32_t Console_History_GetLength(void)
 {
-    return m_History->count;
+    return m_History.count;
 }
 
 void Console_History_Clear(void)
 {
-    for (int32_t i = m_History->count - 1; i >= 0; i--) {
-        char *const prompt = *(char **)Vector_Get(m_History, i);
-        Memory_Free(prompt);
+    for (int32_t i = m_History.count - 1; i >= 0; i--) {
+        Memory_Free(m_History.items[i]);
     }
-    Vector_Clear(m_History);
+    HISTORY_ENTRY_Vector_Clear(&m_History);
 }
 
 void Console_History_Append(const char *const prompt)
 {
-    if (m_History->count == MAX_HISTORY_ENTRIES) {
-        char *const prompt = *(char **)Vector_Get(m_History, 0);
-        Memory_Free(prompt);
-        Vector_RemoveAt(m_History, 0);
+    if (m_History.count == MAX_HISTORY_ENTRIES) {
+        Memory_Free(m_History.items[0]);
+        HISTORY_ENTRY_Vector_RemoveAt(&m_History, 0);
     }
-    char *prompt_copy = Memory_DupStr(prompt);
-    Vector_Add(m_History, &prompt_copy);
+    HISTORY_ENTRY_Vector_Push(&m_History, Memory_DupStr(prompt));
 }
 
 const char *Console_History_Get(const int32_t idx)
 {
-    if (idx < 0 || idx >= m_History->count) {
+    if (idx < 0 || idx >= m_History.count) {
         return nullptr;
     }
-    const char *const prompt = *(char **)Vector_Get(m_History, idx);
-    return prompt;
+    return m_History.items[idx];
 }
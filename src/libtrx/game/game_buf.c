@@ -1,28 +1,196 @@
 #include "game/game_buf.h"
 
+#include "debug.h"
 #include "enum_map.h"
+#include "log.h"
 #include "memory.h"
+#include "utils.h"
 
+#if defined(GAME_BUF_DEBUG) && !defined(_WIN32)
+    #include <sys/mman.h>
+    #include <unistd.h>
+#else
+    #undef GAME_BUF_DEBUG
+#endif
+
+#if defined(GAME_BUF_DEBUG)
+    #define GUARDED_CHUNK_SIZE (8 * 1024 * 1024)
+
+// Every buffer type gets its own arena. Chunks are reserved inaccessible and
+// pages are only opened up as allocations reach them, so an overrun past the
+// newest allocation of a type faults immediately instead of silently
+// corrupting another buffer. Each chunk costs at most two mappings.
+typedef struct GAME_BUF_GUARDED_CHUNK {
+    char *memory;
+    size_t size;
+    size_t offset;
+    size_t committed;
+    struct GAME_BUF_GUARDED_CHUNK *next;
+} GAME_BUF_GUARDED_CHUNK;
+
+static GAME_BUF_GUARDED_CHUNK *m_GuardedArenas[GBUF_NUM_MALLOC_TYPES] = {};
+#else
 static MEMORY_ARENA_ALLOCATOR m_Allocator = {
     .default_chunk_size = 1024 * 1024 * 5,
 };
+#endif
+
+static GAME_BUF_STATS m_Stats[GBUF_NUM_MALLOC_TYPES] = {};
+static size_t m_TotalBytes = 0;
+static size_t m_TotalPeakBytes = 0;
+
+#if defined(GAME_BUF_DEBUG)
+static GAME_BUF_GUARDED_CHUNK *M_GuardedAllocChunk(size_t size);
+static void *M_GuardedAlloc(GAME_BUFFER buffer, size_t size);
+static void M_GuardedFreeAll(void);
+
+static GAME_BUF_GUARDED_CHUNK *M_GuardedAllocChunk(const size_t size)
+{
+    // Keep at least one inaccessible page past the end of the chunk.
+    const size_t page_size = (size_t)sysconf(_SC_PAGESIZE);
+    const size_t min_size = MAX((size_t)GUARDED_CHUNK_SIZE, size + page_size);
+    const size_t chunk_size =
+        (min_size + page_size - 1) / page_size * page_size;
+
+    void *const memory = mmap(
+        nullptr, chunk_size, PROT_NONE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+    ASSERT(memory != MAP_FAILED);
+
+    GAME_BUF_GUARDED_CHUNK *const chunk =
+        Memory_Alloc(sizeof(GAME_BUF_GUARDED_CHUNK));
+    chunk->memory = memory;
+    chunk->size = chunk_size;
+    return chunk;
+}
+
+static void *M_GuardedAlloc(const GAME_BUFFER buffer, const size_t size)
+{
+    const size_t page_size = (size_t)sysconf(_SC_PAGESIZE);
+    GAME_BUF_GUARDED_CHUNK *chunk = m_GuardedArenas[buffer];
+    if (chunk == nullptr || chunk->offset + size > chunk->size - page_size) {
+        GAME_BUF_GUARDED_CHUNK *const new_chunk = M_GuardedAllocChunk(size);
+        new_chunk->next = chunk;
+        m_GuardedArenas[buffer] = new_chunk;
+        chunk = new_chunk;
+    }
+
+    void *const result = chunk->memory + chunk->offset;
+    chunk->offset += size;
+
+    const size_t needed =
+        (chunk->offset + page_size - 1) / page_size * page_size;
+    if (needed > chunk->committed) {
+        ASSERT(
+            mprotect(
+                chunk->memory + chunk->committed, needed - chunk->committed,
+                PROT_READ | PROT_WRITE)
+            == 0);
+        chunk->committed = needed;
+    }
+
+    // Anonymous mappings are already zeroed.
+    return result;
+}
+
+static void M_GuardedFreeAll(void)
+{
+    for (int32_t i = 0; i < GBUF_NUM_MALLOC_TYPES; i++) {
+        GAME_BUF_GUARDED_CHUNK *chunk = m_GuardedArenas[i];
+        while (chunk != nullptr) {
+            GAME_BUF_GUARDED_CHUNK *const next = chunk->next;
+            munmap(chunk->memory, chunk->size);
+            Memory_Free(chunk);
+            chunk = next;
+        }
+        m_GuardedArenas[i] = nullptr;
+    }
+}
+#endif
 
 void GameBuf_Init(void)
 {
+#if defined(GAME_BUF_DEBUG)
+    LOG_INFO("Using guarded per-buffer arenas");
+#endif
 }
 
 void GameBuf_Reset(void)
 {
+    for (int32_t i = 0; i < GBUF_NUM_MALLOC_TYPES; i++) {
+        m_Stats[i].bytes = 0;
+        m_Stats[i].allocs = 0;
+    }
+    m_TotalBytes = 0;
+#if defined(GAME_BUF_DEBUG)
+    M_GuardedFreeAll();
+#else
     Memory_ArenaReset(&m_Allocator);
+#endif
 }
 
 void GameBuf_Shutdown(void)
 {
+#if defined(GAME_BUF_DEBUG)
+    M_GuardedFreeAll();
+#else
     Memory_ArenaFree(&m_Allocator);
+#endif
 }
 
 void *GameBuf_Alloc(const size_t alloc_size, const GAME_BUFFER buffer)
 {
+    ASSERT(buffer >= 0 && buffer < GBUF_NUM_MALLOC_TYPES);
     const size_t aligned_size = (alloc_size + 3) & ~3;
+
+    GAME_BUF_STATS *const stats = &m_Stats[buffer];
+    stats->bytes += aligned_size;
+    stats->allocs++;
+    if (stats->bytes > stats->peak_bytes) {
+        stats->peak_bytes = stats->bytes;
+    }
+    m_TotalBytes += aligned_size;
+    if (m_TotalBytes > m_TotalPeakBytes) {
+        m_TotalPeakBytes = m_TotalBytes;
+    }
+
+#if defined(GAME_BUF_DEBUG)
+    return M_GuardedAlloc(buffer, aligned_size);
+#else
     return Memory_ArenaAlloc(&m_Allocator, aligned_size);
+#endif
+}
+
+const GAME_BUF_STATS *GameBuf_GetStats(const GAME_BUFFER buffer)
+{
+    ASSERT(buffer >= 0 && buffer < GBUF_NUM_MALLOC_TYPES);
+    return &m_Stats[buffer];
+}
+
+size_t GameBuf_GetTotalBytes(void)
+{
+    return m_TotalBytes;
+}
+
+size_t GameBuf_GetTotalPeakBytes(void)
+{
+    return m_TotalPeakBytes;
+}
+
+void GameBuf_DumpStats(void)
+{
+    size_t total_allocs = 0;
+    for (int32_t i = 0; i < GBUF_NUM_MALLOC_TYPES; i++) {
+        const GAME_BUF_STATS *const stats = &m_Stats[i];
+        total_allocs += stats->allocs;
+        if (stats->peak_bytes == 0) {
+            continue;
+        }
+        LOG_INFO(
+            "%-26s %10zu bytes in %6zu allocs (peak: %zu bytes)",
+            ENUM_MAP_TO_STRING(GAME_BUFFER, i), stats->bytes, stats->allocs,
+            stats->peak_bytes);
+    }
+    LOG_INFO(
+        "%-26s %10zu bytes in %6zu allocs (peak: %zu bytes)", "Total",
+        m_TotalBytes, total_allocs, m_TotalPeakBytes);
 }
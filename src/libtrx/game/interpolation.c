@@ -1,6 +1,7 @@
 #include "game/interpolation.h"
 
 #include "config.h"
+#include "game/clock/const.h"
 
 #include <stdint.h>
 
@@ -18,7 +19,7 @@ static int32_t M_GetFPS(void)
 
 bool Interpolation_IsEnabled(void)
 {
-    return m_IsEnabled && M_GetFPS() == 60;
+    return m_IsEnabled && M_GetFPS() > LOGIC_FPS;
 }
 
 void Interpolation_Disable(void)
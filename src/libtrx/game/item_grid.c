@@ -0,0 +1,280 @@
+#include "game/item_grid.h"
+
+#include "debug.h"
+#include "game/const.h"
+#include "game/game_buf.h"
+#include "game/items.h"
+#include "game/rooms.h"
+#include "memory.h"
+#include "utils.h"
+
+#define NO_CELL (-1)
+// Not every position change goes through Item_Animate (e.g. collision
+// push-outs), so queries are widened to catch items whose cell lags behind.
+#define QUERY_MARGIN WALL_L
+
+static bool m_IsDirty = true;
+static int32_t m_CellCount = 0;
+static int16_t *m_CellItems = nullptr;
+static int32_t *m_RoomCellBase = nullptr;
+static int32_t *m_RoomHeadOrder = nullptr;
+static int32_t *m_RoomItemCount = nullptr;
+static int32_t *m_ItemCell = nullptr;
+static int32_t *m_ItemOrder = nullptr;
+static int16_t *m_ItemRoom = nullptr;
+static int16_t *m_ItemNextInCell = nullptr;
+
+static int32_t M_GetSectorX(const ROOM *room, int32_t x);
+static int32_t M_GetSectorZ(const ROOM *room, int32_t z);
+static int32_t M_GetCell(int16_t room_num, int32_t x, int32_t z);
+static void M_AddToCell(int16_t item_num, int32_t cell);
+static void M_RemoveFromCell(int16_t item_num);
+static void M_Allocate(void);
+static void M_Rebuild(void);
+
+static int32_t M_GetSectorX(const ROOM *const room, const int32_t x)
+{
+    int32_t x_sector = (x - room->pos.x) >> WALL_SHIFT;
+    CLAMP(x_sector, 0, room->size.x - 1);
+    return x_sector;
+}
+
+static int32_t M_GetSectorZ(const ROOM *const room, const int32_t z)
+{
+    int32_t z_sector = (z - room->pos.z) >> WALL_SHIFT;
+    CLAMP(z_sector, 0, room->size.z - 1);
+    return z_sector;
+}
+
+static int32_t M_GetCell(
+    const int16_t room_num, const int32_t x, const int32_t z)
+{
+    const ROOM *const room = Room_Get(room_num);
+    return m_RoomCellBase[room_num] + M_GetSectorZ(room, z)
+        + M_GetSectorX(room, x) * room->size.z;
+}
+
+static void M_AddToCell(const int16_t item_num, const int32_t cell)
+{
+    m_ItemCell[item_num] = cell;
+    m_ItemNextInCell[item_num] = m_CellItems[cell];
+    m_CellItems[cell] = item_num;
+}
+
+static void M_RemoveFromCell(const int16_t item_num)
+{
+    const int32_t cell = m_ItemCell[item_num];
+    if (cell == NO_CELL) {
+        return;
+    }
+
+    int16_t link_num = m_CellItems[cell];
+    if (link_num == item_num) {
+        m_CellItems[cell] = m_ItemNextInCell[item_num];
+    } else {
+        while (link_num != NO_ITEM) {
+            if (m_ItemNextInCell[link_num] == item_num) {
+                m_ItemNextInCell[link_num] = m_ItemNextInCell[item_num];
+                break;
+            }
+            link_num = m_ItemNextInCell[link_num];
+        }
+    }
+    m_ItemCell[item_num] = NO_CELL;
+}
+
+static void M_Allocate(void)
+{
+    const int32_t room_count = Room_GetCount();
+    m_CellCount = 0;
+    for (int32_t i = 0; i < room_count; i++) {
+        const ROOM *const room = Room_Get(i);
+        m_CellCount += room->size.x * room->size.z;
+    }
+
+    m_CellItems = GameBuf_Alloc(sizeof(int16_t) * m_CellCount, GBUF_ROOMS);
+    m_RoomCellBase = GameBuf_Alloc(sizeof(int32_t) * room_count, GBUF_ROOMS);
+    m_RoomHeadOrder = GameBuf_Alloc(sizeof(int32_t) * room_count, GBUF_ROOMS);
+    m_RoomItemCount = GameBuf_Alloc(sizeof(int32_t) * room_count, GBUF_ROOMS);
+    m_ItemCell = GameBuf_Alloc(sizeof(int32_t) * MAX_ITEMS, GBUF_ITEMS);
+    m_ItemOrder = GameBuf_Alloc(sizeof(int32_t) * MAX_ITEMS, GBUF_ITEMS);
+    m_ItemRoom = GameBuf_Alloc(sizeof(int16_t) * MAX_ITEMS, GBUF_ITEMS);
+    m_ItemNextInCell = GameBuf_Alloc(sizeof(int16_t) * MAX_ITEMS, GBUF_ITEMS);
+}
+
+static void M_Rebuild(void)
+{
+    if (m_CellItems == nullptr) {
+        M_Allocate();
+    }
+
+    // Flipmaps swap room geometry around, so the cell layout is recomputed
+    // every time. The total stays the same as rooms are only permuted.
+    const int32_t room_count = Room_GetCount();
+    int32_t cell_count = 0;
+    for (int32_t i = 0; i < room_count; i++) {
+        const ROOM *const room = Room_Get(i);
+        m_RoomCellBase[i] = cell_count;
+        cell_count += room->size.x * room->size.z;
+    }
+    ASSERT(cell_count <= m_CellCount);
+
+    for (int32_t i = 0; i < m_CellCount; i++) {
+        m_CellItems[i] = NO_ITEM;
+    }
+    for (int32_t i = 0; i < MAX_ITEMS; i++) {
+        m_ItemCell[i] = NO_CELL;
+    }
+
+    for (int32_t i = 0; i < room_count; i++) {
+        int32_t order = 0;
+        int16_t item_num = Room_Get(i)->item_num;
+        while (item_num != NO_ITEM) {
+            const ITEM *const item = Item_Get(item_num);
+            m_ItemOrder[item_num] = order++;
+            m_ItemRoom[item_num] = i;
+            M_AddToCell(item_num, M_GetCell(i, item->pos.x, item->pos.z));
+            item_num = item->next_item;
+        }
+        m_RoomHeadOrder[i] = 0;
+        m_RoomItemCount[i] = order;
+    }
+
+    m_IsDirty = false;
+}
+
+void ItemGrid_Init(void)
+{
+    m_IsDirty = true;
+    m_CellCount = 0;
+    m_CellItems = nullptr;
+    m_RoomCellBase = nullptr;
+    m_RoomHeadOrder = nullptr;
+    m_RoomItemCount = nullptr;
+    m_ItemCell = nullptr;
+    m_ItemOrder = nullptr;
+    m_ItemRoom = nullptr;
+    m_ItemNextInCell = nullptr;
+}
+
+void ItemGrid_Invalidate(void)
+{
+    m_IsDirty = true;
+}
+
+void ItemGrid_Sync(void)
+{
+    if (m_IsDirty) {
+        return;
+    }
+
+    for (int32_t i = 0; i < Item_GetTotalCount(); i++) {
+        ItemGrid_Update(i);
+    }
+}
+
+void ItemGrid_Link(const int16_t item_num)
+{
+    if (m_IsDirty) {
+        return;
+    }
+
+    ItemGrid_Unlink(item_num);
+
+    const ITEM *const item = Item_Get(item_num);
+    const int16_t room_num = item->room_num;
+    // The list is built by pushing to the front, so the newest item always
+    // sorts before everything else in the room.
+    m_ItemOrder[item_num] = --m_RoomHeadOrder[room_num];
+    m_ItemRoom[item_num] = room_num;
+    m_RoomItemCount[room_num]++;
+    M_AddToCell(item_num, M_GetCell(room_num, item->pos.x, item->pos.z));
+}
+
+void ItemGrid_Unlink(const int16_t item_num)
+{
+    if (m_IsDirty || m_ItemCell[item_num] == NO_CELL) {
+        return;
+    }
+
+    M_RemoveFromCell(item_num);
+    m_RoomItemCount[m_ItemRoom[item_num]]--;
+}
+
+void ItemGrid_Update(const int16_t item_num)
+{
+    if (m_IsDirty || m_ItemCell[item_num] == NO_CELL) {
+        return;
+    }
+
+    const ITEM *const item = Item_Get(item_num);
+    const int32_t cell =
+        M_GetCell(m_ItemRoom[item_num], item->pos.x, item->pos.z);
+    if (cell != m_ItemCell[item_num]) {
+        M_RemoveFromCell(item_num);
+        M_AddToCell(item_num, cell);
+    }
+}
+
+const int16_t *ItemGrid_GetNearbyItems(
+    const int16_t room_num, const int32_t x, const int32_t z,
+    const int32_t radius)
+{
+    if (m_IsDirty) {
+        M_Rebuild();
+    }
+
+    const ROOM *const room = Room_Get(room_num);
+    const int32_t reach = radius + QUERY_MARGIN;
+    const int32_t x_min = M_GetSectorX(room, x - reach);
+    const int32_t x_max = M_GetSectorX(room, x + reach);
+    const int32_t z_min = M_GetSectorZ(room, z - reach);
+    const int32_t z_max = M_GetSectorZ(room, z + reach);
+
+    const int32_t item_count = m_RoomItemCount[room_num];
+    int16_t *const result =
+        Memory_FrameAlloc(sizeof(int16_t) * (item_count + 1));
+    int32_t count = 0;
+
+    // For sparsely populated rooms walking the list directly beats visiting
+    // every overlapping cell, and it is already in the right order.
+    const int32_t cell_count = (x_max - x_min + 1) * (z_max - z_min + 1);
+    if (item_count <= cell_count) {
+        int16_t item_num = room->item_num;
+        while (item_num != NO_ITEM) {
+            ASSERT(count < item_count);
+            result[count++] = item_num;
+            item_num = Item_Get(item_num)->next_item;
+        }
+        result[count] = NO_ITEM;
+        return result;
+    }
+
+    const int32_t base = m_RoomCellBase[room_num];
+    for (int32_t x_sector = x_min; x_sector <= x_max; x_sector++) {
+        for (int32_t z_sector = z_min; z_sector <= z_max; z_sector++) {
+            const int32_t cell = base + z_sector + x_sector * room->size.z;
+            int16_t item_num = m_CellItems[cell];
+            while (item_num != NO_ITEM) {
+                result[count++] = item_num;
+                item_num = m_ItemNextInCell[item_num];
+            }
+        }
+    }
+
+    // Restore the room item list order so that callers behave exactly as if
+    // they walked the list themselves.
+    for (int32_t i = 1; i < count; i++) {
+        const int16_t item_num = result[i];
+        const int32_t order = m_ItemOrder[item_num];
+        int32_t j = i - 1;
+        while (j >= 0 && m_ItemOrder[result[j]] > order) {
+            result[j + 1] = result[j];
+            j--;
+        }
+        result[j + 1] = item_num;
+    }
+
+    result[count] = NO_ITEM;
+    return result;
+}
@@ -3,6 +3,7 @@
 #include "game/const.h"
 #include "game/game_buf.h"
 #include "game/item_actions.h"
+#include "game/item_grid.h"
 #include "game/lara/common.h"
 #include "game/objects/common.h"
 #include "game/objects/vars.h"
@@ -20,6 +21,7 @@ static int16_t m_NextItemFree = NO_ITEM;
 void Item_InitialiseItems(const int32_t num_items)
 {
     m_Items = GameBuf_Alloc(sizeof(ITEM) * MAX_ITEMS, GBUF_ITEMS);
+    ItemGrid_Init();
     m_LevelItemCount = num_items;
     m_MaxUsedItemCount = num_items;
     m_NextItemFree = num_items;
@@ -153,6 +155,7 @@ void Item_RemoveDrawn(const int16_t item_num)
         return;
     }
 
+    ItemGrid_Unlink(item_num);
     ROOM *const room = Room_Get(item->room_num);
     int16_t link_num = room->item_num;
     if (link_num == item_num) {
@@ -192,6 +195,7 @@ void Item_NewRoom(const int16_t item_num, const int16_t room_num)
     ROOM *room = nullptr;
 
     if (item->room_num != NO_ROOM) {
+        ItemGrid_Unlink(item_num);
         room = Room_Get(item->room_num);
 
         int16_t link_num = room->item_num;
@@ -212,6 +216,7 @@ void Item_NewRoom(const int16_t item_num, const int16_t room_num)
     item->room_num = room_num;
     item->next_item = room->item_num;
     room->item_num = item_num;
+    ItemGrid_Link(item_num);
 }
 
 int32_t Item_GlobalReplace(
@@ -231,6 +236,9 @@ int32_t Item_GlobalReplace(
         }
     }
 
+    if (changed > 0) {
+        Room_MarkDynamicSectors();
+    }
     return changed;
 }
 
@@ -462,6 +470,7 @@ void Item_Animate(ITEM *const item)
 
     item->pos.x += (item->speed * Math_Sin(item->rot.y)) >> W2V_SHIFT;
     item->pos.z += (item->speed * Math_Cos(item->rot.y)) >> W2V_SHIFT;
+    ItemGrid_Update(Item_GetIndex(item));
 }
 
 void Item_PlayAnimSFX(
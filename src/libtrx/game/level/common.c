@@ -20,13 +20,19 @@
 #include "log.h"
 #include "memory.h"
 #include "utils.h"
-#include "vector.h"
 
+#include <stdlib.h>
 #include <string.h>
 
+typedef struct {
+    int32_t pointer;
+    int32_t index;
+} M_MESH_POINTER;
+
 static int16_t *m_AnimCommands = nullptr;
 
 static RGBA_8888 M_ARGB1555To8888(uint16_t argb1555);
+static int M_CompareMeshPointers(const void *a, const void *b);
 static void M_ReadPosition(XYZ_32 *pos, VFILE *file);
 static void M_ReadShade(SHADE *shade, VFILE *file);
 static void M_ReadVertex(XYZ_16 *vertex, VFILE *file);
@@ -59,6 +65,16 @@ static RGBA_8888 M_ARGB1555To8888(const uint16_t argb1555)
     };
 }
 
+static int M_CompareMeshPointers(const void *const a, const void *const b)
+{
+    const M_MESH_POINTER *const entry_a = a;
+    const M_MESH_POINTER *const entry_b = b;
+    if (entry_a->pointer != entry_b->pointer) {
+        return entry_a->pointer < entry_b->pointer ? -1 : 1;
+    }
+    return entry_a->index - entry_b->index;
+}
+
 static void M_ReadPosition(XYZ_32 *const pos, VFILE *const file)
 {
     pos->x = VFile_ReadS32(file);
@@ -462,26 +478,42 @@ void Level_ReadObjectMeshes(
     const int32_t num_indices, const int32_t *const indices, VFILE *const file)
 {
     // Construct and store distinct meshes only e.g. Lara's hips are referenced
-    // by several pointers as a dummy mesh.
-    VECTOR *const unique_indices =
-        Vector_CreateAtCapacity(sizeof(int32_t), num_indices);
+    // by several pointers as a dummy mesh. Sorting the pointers groups the
+    // duplicates together; the first use of each one decides where its mesh
+    // goes, so meshes stay in order of appearance.
+    M_MESH_POINTER *const sorted =
+        Memory_Alloc(sizeof(M_MESH_POINTER) * num_indices);
+    for (int32_t i = 0; i < num_indices; i++) {
+        sorted[i].pointer = indices[i];
+        sorted[i].index = i;
+    }
+    qsort(sorted, num_indices, sizeof(M_MESH_POINTER), M_CompareMeshPointers);
+
+    int32_t *const first_use = Memory_Alloc(sizeof(int32_t) * num_indices);
+    for (int32_t i = 0; i < num_indices; i++) {
+        const bool is_first =
+            i == 0 || sorted[i].pointer != sorted[i - 1].pointer;
+        first_use[sorted[i].index] =
+            is_first ? sorted[i].index : first_use[sorted[i - 1].index];
+    }
+
+    int32_t *const unique_indices = Memory_Alloc(sizeof(int32_t) * num_indices);
+    int32_t unique_count = 0;
     int32_t pointer_map[num_indices];
     for (int32_t i = 0; i < num_indices; i++) {
-        const int32_t pointer = indices[i];
-        const int32_t index = Vector_IndexOf(unique_indices, (void *)&pointer);
-        if (index == -1) {
-            pointer_map[i] = unique_indices->count;
-            Vector_Add(unique_indices, (void *)&pointer);
+        if (first_use[i] == i) {
+            pointer_map[i] = unique_count;
+            unique_indices[unique_count++] = indices[i];
         } else {
-            pointer_map[i] = index;
+            pointer_map[i] = pointer_map[first_use[i]];
         }
     }
 
     OBJECT_MESH *const meshes =
-        GameBuf_Alloc(sizeof(OBJECT_MESH) * unique_indices->count, GBUF_MESHES);
+        GameBuf_Alloc(sizeof(OBJECT_MESH) * unique_count, GBUF_MESHES);
     size_t start_pos = VFile_GetPos(file);
-    for (int i = 0; i < unique_indices->count; i++) {
-        const int32_t pointer = *(const int32_t *)Vector_Get(unique_indices, i);
+    for (int i = 0; i < unique_count; i++) {
+        const int32_t pointer = unique_indices[i];
         VFile_SetPos(file, start_pos + pointer);
         M_ReadObjectMesh(&meshes[i], file);
 
@@ -494,9 +526,11 @@ void Level_ReadObjectMeshes(
         Object_StoreMesh(&meshes[pointer_map[i]]);
     }
 
-    LOG_INFO("%d unique meshes constructed", unique_indices->count);
+    LOG_INFO("%d unique meshes constructed", unique_count);
 
-    Vector_Free(unique_indices);
+    Memory_Free(sorted);
+    Memory_Free(first_use);
+    Memory_Free(unique_indices);
 }
 
 void Level_ReadAnims(
@@ -979,4 +1013,6 @@ void Level_LoadObjectsAndItems(void)
     for (int32_t i = 0; i < item_count; i++) {
         Item_Initialise(i);
     }
+
+    Room_MarkDynamicSectors();
 }
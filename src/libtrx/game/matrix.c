@@ -3,107 +3,21 @@
 #include "game/const.h"
 #include "game/math.h"
 
-#define MAX_MATRICES 40
-#define MAX_NESTED_MATRICES 32
-
-MATRIX *g_MatrixPtr = nullptr;
+MATRIX_STACK g_MatrixStack = {};
 MATRIX g_W2VMatrix = {};
 
-static MATRIX m_MatrixStack[MAX_MATRICES] = {};
-static int32_t m_IMRate = 0;
-static int32_t m_IMFrac = 0;
-static MATRIX *m_IMMatrixPtr = nullptr;
-static MATRIX m_IMMatrixStack[MAX_NESTED_MATRICES] = {};
-
-static void M_RotYXZ(const int16_t ry, const int16_t rx, const int16_t rz)
-{
-    Matrix_RotY(ry);
-    Matrix_RotX(rx);
-    Matrix_RotZ(rz);
-}
-
-static void M_RotYXZ_I(const int16_t y, const int16_t x, const int16_t z)
-{
-    M_RotYXZ(y, x, z);
-    MATRIX *const old_matrix = g_MatrixPtr;
-    g_MatrixPtr = m_IMMatrixPtr;
-    M_RotYXZ(y, x, z);
-    g_MatrixPtr = old_matrix;
-}
-
-void Matrix_ResetStack(void)
-{
-    g_MatrixPtr = &m_MatrixStack[0];
-}
-
-void Matrix_GenerateW2V(const XYZ_32 *pos, const XYZ_16 *rot)
-{
-    g_MatrixPtr = &m_MatrixStack[0];
-    const int32_t sx = Math_Sin(rot->x);
-    const int32_t cx = Math_Cos(rot->x);
-    const int32_t sy = Math_Sin(rot->y);
-    const int32_t cy = Math_Cos(rot->y);
-    const int32_t sz = Math_Sin(rot->z);
-    const int32_t cz = Math_Cos(rot->z);
-
-    m_MatrixStack[0]._00 = TRIGMULT3(sx, sy, sz) + TRIGMULT2(cy, cz);
-    m_MatrixStack[0]._01 = TRIGMULT2(cx, sz);
-    m_MatrixStack[0]._02 = TRIGMULT3(sx, cy, sz) - TRIGMULT2(sy, cz);
-    m_MatrixStack[0]._10 = TRIGMULT3(sx, sy, cz) - TRIGMULT2(cy, sz);
-    m_MatrixStack[0]._11 = TRIGMULT2(cx, cz);
-    m_MatrixStack[0]._12 = TRIGMULT3(sx, cy, cz) + TRIGMULT2(sy, sz);
-    m_MatrixStack[0]._20 = TRIGMULT2(cx, sy);
-    m_MatrixStack[0]._21 = -sx;
-    m_MatrixStack[0]._22 = TRIGMULT2(cx, cy);
-    m_MatrixStack[0]._03 = pos->x;
-    m_MatrixStack[0]._13 = pos->y;
-    m_MatrixStack[0]._23 = pos->z;
-    g_W2VMatrix = m_MatrixStack[0];
-}
-
-bool Matrix_Push(void)
-{
-    if (g_MatrixPtr + 1 - m_MatrixStack >= MAX_MATRICES) {
-        return false;
-    }
-    g_MatrixPtr++;
-    g_MatrixPtr[0] = g_MatrixPtr[-1];
-    return true;
-}
-
-bool Matrix_PushUnit(void)
-{
-    if (g_MatrixPtr + 1 - m_MatrixStack >= MAX_MATRICES) {
-        return false;
-    }
-    MATRIX *const mptr = ++g_MatrixPtr;
-    mptr->_00 = 1 << W2V_SHIFT;
-    mptr->_01 = 0;
-    mptr->_02 = 0;
-    mptr->_10 = 0;
-    mptr->_11 = 1 << W2V_SHIFT;
-    mptr->_12 = 0;
-    mptr->_20 = 0;
-    mptr->_21 = 0;
-    mptr->_22 = 1 << W2V_SHIFT;
-    mptr->_03 = 0;
-    mptr->_13 = 0;
-    mptr->_23 = 0;
-    return true;
-}
-
-void Matrix_Pop(void)
-{
-    g_MatrixPtr--;
-}
+static void M_RotX(MATRIX *mptr, int16_t rx);
+static void M_RotY(MATRIX *mptr, int16_t ry);
+static void M_RotZ(MATRIX *mptr, int16_t rz);
+static void M_RotYXZ(MATRIX *mptr, int16_t ry, int16_t rx, int16_t rz);
+static void M_TranslateRel(MATRIX *mptr, int32_t x, int32_t y, int32_t z);
 
-void Matrix_RotX(const int16_t rx)
+static void M_RotX(MATRIX *const mptr, const int16_t rx)
 {
     if (!rx) {
         return;
     }
 
-    MATRIX *const mptr = g_MatrixPtr;
     const int32_t sx = Math_Sin(rx);
     const int32_t cx = Math_Cos(rx);
 
@@ -124,13 +38,12 @@ void Matrix_RotX(const int16_t rx)
     mptr->_22 = r1 >> W2V_SHIFT;
 }
 
-void Matrix_RotY(const int16_t ry)
+static void M_RotY(MATRIX *const mptr, const int16_t ry)
 {
     if (!ry) {
         return;
     }
 
-    MATRIX *const mptr = g_MatrixPtr;
     const int32_t sy = Math_Sin(ry);
     const int32_t cy = Math_Cos(ry);
 
@@ -151,13 +64,12 @@ void Matrix_RotY(const int16_t ry)
     mptr->_22 = r1 >> W2V_SHIFT;
 }
 
-void Matrix_RotZ(const int16_t rz)
+static void M_RotZ(MATRIX *const mptr, const int16_t rz)
 {
     if (!rz) {
         return;
     }
 
-    MATRIX *const mptr = g_MatrixPtr;
     const int32_t sz = Math_Sin(rz);
     const int32_t cz = Math_Cos(rz);
 
@@ -178,32 +90,115 @@ void Matrix_RotZ(const int16_t rz)
     mptr->_21 = r1 >> W2V_SHIFT;
 }
 
-void Matrix_Rot16(const XYZ_16 rotation)
+static void M_RotYXZ(
+    MATRIX *const mptr, const int16_t ry, const int16_t rx, const int16_t rz)
 {
-    M_RotYXZ(rotation.y, rotation.x, rotation.z);
+    M_RotY(mptr, ry);
+    M_RotX(mptr, rx);
+    M_RotZ(mptr, rz);
 }
 
-void Matrix_TranslateRel(const int32_t x, const int32_t y, const int32_t z)
+static void M_TranslateRel(
+    MATRIX *const mptr, const int32_t x, const int32_t y, const int32_t z)
 {
-    MATRIX *const mptr = g_MatrixPtr;
     mptr->_03 += x * mptr->_00 + y * mptr->_01 + z * mptr->_02;
     mptr->_13 += x * mptr->_10 + y * mptr->_11 + z * mptr->_12;
     mptr->_23 += x * mptr->_20 + y * mptr->_21 + z * mptr->_22;
 }
 
-void Matrix_TranslateRel16(const XYZ_16 offset)
+void MatrixStack_Reset(MATRIX_STACK *const stack, const MATRIX *const base)
 {
-    Matrix_TranslateRel(offset.x, offset.y, offset.z);
+    stack->ptr = &stack->items[0];
+    if (base != nullptr) {
+        stack->items[0] = *base;
+    }
 }
 
-void Matrix_TranslateRel32(const XYZ_32 offset)
+bool MatrixStack_Push(MATRIX_STACK *const stack)
 {
-    Matrix_TranslateRel(offset.x, offset.y, offset.z);
+    if (stack->ptr + 1 - stack->items >= MAX_MATRICES) {
+        return false;
+    }
+    stack->ptr++;
+    stack->ptr[0] = stack->ptr[-1];
+    return true;
 }
 
-void Matrix_TranslateAbs(const int32_t x, const int32_t y, const int32_t z)
+bool MatrixStack_PushUnit(MATRIX_STACK *const stack)
+{
+    if (stack->ptr + 1 - stack->items >= MAX_MATRICES) {
+        return false;
+    }
+    MATRIX *const mptr = ++stack->ptr;
+    mptr->_00 = 1 << W2V_SHIFT;
+    mptr->_01 = 0;
+    mptr->_02 = 0;
+    mptr->_10 = 0;
+    mptr->_11 = 1 << W2V_SHIFT;
+    mptr->_12 = 0;
+    mptr->_20 = 0;
+    mptr->_21 = 0;
+    mptr->_22 = 1 << W2V_SHIFT;
+    mptr->_03 = 0;
+    mptr->_13 = 0;
+    mptr->_23 = 0;
+    return true;
+}
+
+void MatrixStack_Pop(MATRIX_STACK *const stack)
 {
-    MATRIX *const mptr = g_MatrixPtr;
+    stack->ptr--;
+}
+
+void MatrixStack_RotX(MATRIX_STACK *const stack, const int16_t rx)
+{
+    M_RotX(stack->ptr, rx);
+}
+
+void MatrixStack_RotY(MATRIX_STACK *const stack, const int16_t ry)
+{
+    M_RotY(stack->ptr, ry);
+}
+
+void MatrixStack_RotZ(MATRIX_STACK *const stack, const int16_t rz)
+{
+    M_RotZ(stack->ptr, rz);
+}
+
+void MatrixStack_RotYXZ(
+    MATRIX_STACK *const stack, const int16_t ry, const int16_t rx,
+    const int16_t rz)
+{
+    M_RotYXZ(stack->ptr, ry, rx, rz);
+}
+
+void MatrixStack_Rot16(MATRIX_STACK *const stack, const XYZ_16 rotation)
+{
+    M_RotYXZ(stack->ptr, rotation.y, rotation.x, rotation.z);
+}
+
+void MatrixStack_TranslateRel(
+    MATRIX_STACK *const stack, const int32_t x, const int32_t y,
+    const int32_t z)
+{
+    M_TranslateRel(stack->ptr, x, y, z);
+}
+
+void MatrixStack_TranslateRel16(MATRIX_STACK *const stack, const XYZ_16 offset)
+{
+    M_TranslateRel(stack->ptr, offset.x, offset.y, offset.z);
+}
+
+void MatrixStack_TranslateRel32(MATRIX_STACK *const stack, const XYZ_32 offset)
+{
+    M_TranslateRel(stack->ptr, offset.x, offset.y, offset.z);
+}
+
+void MatrixStack_TranslateAbs(
+    MATRIX_STACK *const stack, const int32_t x, const int32_t y,
+    const int32_t z)
+{
+    MATRIX *const mptr = stack->ptr;
     const int32_t dx = x - g_W2VMatrix._03;
     const int32_t dy = y - g_W2VMatrix._13;
     const int32_t dz = z - g_W2VMatrix._23;
@@ -212,164 +207,348 @@ void Matrix_TranslateAbs(const int32_t x, const int32_t y, const int32_t z)
     mptr->_23 = dx * mptr->_20 + dy * mptr->_21 + dz * mptr->_22;
 }
 
-void Matrix_TranslateAbs16(const XYZ_16 offset)
+void MatrixStack_TranslateAbs16(MATRIX_STACK *const stack, const XYZ_16 offset)
 {
-    Matrix_TranslateAbs(offset.x, offset.y, offset.z);
+    MatrixStack_TranslateAbs(stack, offset.x, offset.y, offset.z);
 }
 
-void Matrix_TranslateAbs32(const XYZ_32 offset)
+void MatrixStack_TranslateAbs32(MATRIX_STACK *const stack, const XYZ_32 offset)
 {
-    Matrix_TranslateAbs(offset.x, offset.y, offset.z);
+    MatrixStack_TranslateAbs(stack, offset.x, offset.y, offset.z);
 }
 
-void Matrix_TranslateSet(const int32_t x, const int32_t y, const int32_t z)
+void MatrixStack_TranslateSet(
+    MATRIX_STACK *const stack, const int32_t x, const int32_t y,
+    const int32_t z)
 {
-    MATRIX *const mptr = g_MatrixPtr;
+    MATRIX *const mptr = stack->ptr;
     mptr->_03 = x << W2V_SHIFT;
     mptr->_13 = y << W2V_SHIFT;
     mptr->_23 = z << W2V_SHIFT;
 }
 
-void Matrix_InitInterpolate(const int32_t frac, const int32_t rate)
+void MatrixStack_InitInterpolate(
+    MATRIX_STACK *const stack, const int32_t frac, const int32_t rate)
 {
-    m_IMFrac = frac;
-    m_IMRate = rate;
-    m_IMMatrixPtr = &m_IMMatrixStack[0];
-    *m_IMMatrixPtr = *g_MatrixPtr;
+    stack->interpolation.frac = frac;
+    stack->interpolation.rate = rate;
+    stack->interpolation.ptr = &stack->interpolation.items[0];
+    *stack->interpolation.ptr = *stack->ptr;
 }
 
-void Matrix_Interpolate(void)
+void MatrixStack_Interpolate(MATRIX_STACK *const stack)
 {
-    MATRIX *const mptr = g_MatrixPtr;
-    const MATRIX *const iptr = m_IMMatrixPtr;
+    MATRIX *const mptr = stack->ptr;
+    const MATRIX *const iptr = stack->interpolation.ptr;
+    const int32_t frac = stack->interpolation.frac;
+    const int32_t rate = stack->interpolation.rate;
 
-    mptr->_00 += ((iptr->_00 - mptr->_00) * m_IMFrac) / m_IMRate;
-    mptr->_01 += ((iptr->_01 - mptr->_01) * m_IMFrac) / m_IMRate;
-    mptr->_02 += ((iptr->_02 - mptr->_02) * m_IMFrac) / m_IMRate;
-    mptr->_03 += ((iptr->_03 - mptr->_03) * m_IMFrac) / m_IMRate;
-    mptr->_10 += ((iptr->_10 - mptr->_10) * m_IMFrac) / m_IMRate;
-    mptr->_11 += ((iptr->_11 - mptr->_11) * m_IMFrac) / m_IMRate;
-    mptr->_12 += ((iptr->_12 - mptr->_12) * m_IMFrac) / m_IMRate;
-    mptr->_13 += ((iptr->_13 - mptr->_13) * m_IMFrac) / m_IMRate;
-    mptr->_20 += ((iptr->_20 - mptr->_20) * m_IMFrac) / m_IMRate;
-    mptr->_21 += ((iptr->_21 - mptr->_21) * m_IMFrac) / m_IMRate;
-    mptr->_22 += ((iptr->_22 - mptr->_22) * m_IMFrac) / m_IMRate;
-    mptr->_23 += ((iptr->_23 - mptr->_23) * m_IMFrac) / m_IMRate;
+    mptr->_00 += ((iptr->_00 - mptr->_00) * frac) / rate;
+    mptr->_01 += ((iptr->_01 - mptr->_01) * frac) / rate;
+    mptr->_02 += ((iptr->_02 - mptr->_02) * frac) / rate;
+    mptr->_03 += ((iptr->_03 - mptr->_03) * frac) / rate;
+    mptr->_10 += ((iptr->_10 - mptr->_10) * frac) / rate;
+    mptr->_11 += ((iptr->_11 - mptr->_11) * frac) / rate;
+    mptr->_12 += ((iptr->_12 - mptr->_12) * frac) / rate;
+    mptr->_13 += ((iptr->_13 - mptr->_13) * frac) / rate;
+    mptr->_20 += ((iptr->_20 - mptr->_20) * frac) / rate;
+    mptr->_21 += ((iptr->_21 - mptr->_21) * frac) / rate;
+    mptr->_22 += ((iptr->_22 - mptr->_22) * frac) / rate;
+    mptr->_23 += ((iptr->_23 - mptr->_23) * frac) / rate;
 }
 
-void Matrix_InterpolateArm(void)
+void MatrixStack_InterpolateArm(MATRIX_STACK *const stack)
 {
-    MATRIX *const mptr = g_MatrixPtr;
-    const MATRIX *const iptr = m_IMMatrixPtr;
+    MATRIX *const mptr = stack->ptr;
+    const MATRIX *const iptr = stack->interpolation.ptr;
+    const int32_t frac = stack->interpolation.frac;
+    const int32_t rate = stack->interpolation.rate;
 
     mptr->_00 = mptr[-2]._00;
     mptr->_01 = mptr[-2]._01;
     mptr->_02 = mptr[-2]._02;
-    mptr->_03 += ((iptr->_03 - mptr->_03) * m_IMFrac) / m_IMRate;
+    mptr->_03 += ((iptr->_03 - mptr->_03) * frac) / rate;
     mptr->_10 = mptr[-2]._10;
     mptr->_11 = mptr[-2]._11;
     mptr->_12 = mptr[-2]._12;
-    mptr->_13 += ((iptr->_13 - mptr->_13) * m_IMFrac) / m_IMRate;
+    mptr->_13 += ((iptr->_13 - mptr->_13) * frac) / rate;
     mptr->_20 = mptr[-2]._20;
     mptr->_21 = mptr[-2]._21;
     mptr->_22 = mptr[-2]._22;
-    mptr->_23 += ((iptr->_23 - mptr->_23) * m_IMFrac) / m_IMRate;
+    mptr->_23 += ((iptr->_23 - mptr->_23) * frac) / rate;
+}
+
+void MatrixStack_Push_I(MATRIX_STACK *const stack)
+{
+    MatrixStack_Push(stack);
+    stack->interpolation.ptr[1] = stack->interpolation.ptr[0];
+    stack->interpolation.ptr++;
+}
+
+void MatrixStack_Pop_I(MATRIX_STACK *const stack)
+{
+    MatrixStack_Pop(stack);
+    stack->interpolation.ptr--;
+}
+
+void MatrixStack_TranslateRel_I(
+    MATRIX_STACK *const stack, const int32_t x, const int32_t y,
+    const int32_t z)
+{
+    M_TranslateRel(stack->ptr, x, y, z);
+    M_TranslateRel(stack->interpolation.ptr, x, y, z);
+}
+
+void MatrixStack_TranslateRel16_I(
+    MATRIX_STACK *const stack, const XYZ_16 offset)
+{
+    MatrixStack_TranslateRel_I(stack, offset.x, offset.y, offset.z);
+}
+
+void MatrixStack_TranslateRel32_I(
+    MATRIX_STACK *const stack, const XYZ_32 offset)
+{
+    MatrixStack_TranslateRel_I(stack, offset.x, offset.y, offset.z);
+}
+
+void MatrixStack_TranslateRel_ID(
+    MATRIX_STACK *const stack, const int32_t x, const int32_t y,
+    const int32_t z, const int32_t x2, const int32_t y2, const int32_t z2)
+{
+    M_TranslateRel(stack->ptr, x, y, z);
+    M_TranslateRel(stack->interpolation.ptr, x2, y2, z2);
+}
+
+void MatrixStack_TranslateRel16_ID(
+    MATRIX_STACK *const stack, const XYZ_16 offset_1, const XYZ_16 offset_2)
+{
+    MatrixStack_TranslateRel_ID(
+        stack, offset_1.x, offset_1.y, offset_1.z, offset_2.x, offset_2.y,
+        offset_2.z);
+}
+
+void MatrixStack_TranslateRel32_ID(
+    MATRIX_STACK *const stack, const XYZ_32 offset_1, const XYZ_32 offset_2)
+{
+    MatrixStack_TranslateRel_ID(
+        stack, offset_1.x, offset_1.y, offset_1.z, offset_2.x, offset_2.y,
+        offset_2.z);
+}
+
+void MatrixStack_RotY_I(MATRIX_STACK *const stack, const int16_t ang)
+{
+    M_RotY(stack->ptr, ang);
+    M_RotY(stack->interpolation.ptr, ang);
+}
+
+void MatrixStack_RotX_I(MATRIX_STACK *const stack, const int16_t ang)
+{
+    M_RotX(stack->ptr, ang);
+    M_RotX(stack->interpolation.ptr, ang);
+}
+
+void MatrixStack_RotZ_I(MATRIX_STACK *const stack, const int16_t ang)
+{
+    M_RotZ(stack->ptr, ang);
+    M_RotZ(stack->interpolation.ptr, ang);
+}
+
+void MatrixStack_Rot16_I(MATRIX_STACK *const stack, const XYZ_16 rotation)
+{
+    M_RotYXZ(stack->ptr, rotation.y, rotation.x, rotation.z);
+    M_RotYXZ(stack->interpolation.ptr, rotation.y, rotation.x, rotation.z);
+}
+
+void MatrixStack_Rot16_ID(
+    MATRIX_STACK *const stack, const XYZ_16 rotation_1,
+    const XYZ_16 rotation_2)
+{
+    M_RotYXZ(stack->ptr, rotation_1.y, rotation_1.x, rotation_1.z);
+    M_RotYXZ(
+        stack->interpolation.ptr, rotation_2.y, rotation_2.x, rotation_2.z);
+}
+
+void Matrix_ResetStack(void)
+{
+    MatrixStack_Reset(&g_MatrixStack, nullptr);
+}
+
+void Matrix_GenerateW2V(const XYZ_32 *pos, const XYZ_16 *rot)
+{
+    MATRIX *const mptr = &g_MatrixStack.items[0];
+    g_MatrixStack.ptr = mptr;
+    const int32_t sx = Math_Sin(rot->x);
+    const int32_t cx = Math_Cos(rot->x);
+    const int32_t sy = Math_Sin(rot->y);
+    const int32_t cy = Math_Cos(rot->y);
+    const int32_t sz = Math_Sin(rot->z);
+    const int32_t cz = Math_Cos(rot->z);
+
+    mptr->_00 = TRIGMULT3(sx, sy, sz) + TRIGMULT2(cy, cz);
+    mptr->_01 = TRIGMULT2(cx, sz);
+    mptr->_02 = TRIGMULT3(sx, cy, sz) - TRIGMULT2(sy, cz);
+    mptr->_10 = TRIGMULT3(sx, sy, cz) - TRIGMULT2(cy, sz);
+    mptr->_11 = TRIGMULT2(cx, cz);
+    mptr->_12 = TRIGMULT3(sx, cy, cz) + TRIGMULT2(sy, sz);
+    mptr->_20 = TRIGMULT2(cx, sy);
+    mptr->_21 = -sx;
+    mptr->_22 = TRIGMULT2(cx, cy);
+    mptr->_03 = pos->x;
+    mptr->_13 = pos->y;
+    mptr->_23 = pos->z;
+    g_W2VMatrix = *mptr;
+}
+
+bool Matrix_Push(void)
+{
+    return MatrixStack_Push(&g_MatrixStack);
+}
+
+bool Matrix_PushUnit(void)
+{
+    return MatrixStack_PushUnit(&g_MatrixStack);
+}
+
+void Matrix_Pop(void)
+{
+    MatrixStack_Pop(&g_MatrixStack);
+}
+
+void Matrix_RotX(const int16_t rx)
+{
+    MatrixStack_RotX(&g_MatrixStack, rx);
+}
+
+void Matrix_RotY(const int16_t ry)
+{
+    MatrixStack_RotY(&g_MatrixStack, ry);
+}
+
+void Matrix_RotZ(const int16_t rz)
+{
+    MatrixStack_RotZ(&g_MatrixStack, rz);
+}
+
+void Matrix_Rot16(const XYZ_16 rotation)
+{
+    MatrixStack_Rot16(&g_MatrixStack, rotation);
+}
+
+void Matrix_TranslateRel(const int32_t x, const int32_t y, const int32_t z)
+{
+    MatrixStack_TranslateRel(&g_MatrixStack, x, y, z);
+}
+
+void Matrix_TranslateRel16(const XYZ_16 offset)
+{
+    MatrixStack_TranslateRel16(&g_MatrixStack, offset);
+}
+
+void Matrix_TranslateRel32(const XYZ_32 offset)
+{
+    MatrixStack_TranslateRel32(&g_MatrixStack, offset);
+}
+
+void Matrix_TranslateAbs(const int32_t x, const int32_t y, const int32_t z)
+{
+    MatrixStack_TranslateAbs(&g_MatrixStack, x, y, z);
+}
+
+void Matrix_TranslateAbs16(const XYZ_16 offset)
+{
+    MatrixStack_TranslateAbs16(&g_MatrixStack, offset);
+}
+
+void Matrix_TranslateAbs32(const XYZ_32 offset)
+{
+    MatrixStack_TranslateAbs32(&g_MatrixStack, offset);
+}
+
+void Matrix_TranslateSet(const int32_t x, const int32_t y, const int32_t z)
+{
+    MatrixStack_TranslateSet(&g_MatrixStack, x, y, z);
+}
+
+void Matrix_InitInterpolate(const int32_t frac, const int32_t rate)
+{
+    MatrixStack_InitInterpolate(&g_MatrixStack, frac, rate);
+}
+
+void Matrix_Interpolate(void)
+{
+    MatrixStack_Interpolate(&g_MatrixStack);
+}
+
+void Matrix_InterpolateArm(void)
+{
+    MatrixStack_InterpolateArm(&g_MatrixStack);
 }
 
 void Matrix_Push_I(void)
 {
-    Matrix_Push();
-    m_IMMatrixPtr[1] = m_IMMatrixPtr[0];
-    m_IMMatrixPtr++;
+    MatrixStack_Push_I(&g_MatrixStack);
 }
 
 void Matrix_Pop_I(void)
 {
-    Matrix_Pop();
-    m_IMMatrixPtr--;
+    MatrixStack_Pop_I(&g_MatrixStack);
 }
 
 void Matrix_TranslateRel_I(const int32_t x, const int32_t y, const int32_t z)
 {
-    Matrix_TranslateRel(x, y, z);
-    MATRIX *const old_matrix = g_MatrixPtr;
-    g_MatrixPtr = m_IMMatrixPtr;
-    Matrix_TranslateRel(x, y, z);
-    g_MatrixPtr = old_matrix;
+    MatrixStack_TranslateRel_I(&g_MatrixStack, x, y, z);
 }
 
 void Matrix_TranslateRel16_I(const XYZ_16 offset)
 {
-    Matrix_TranslateRel_I(offset.x, offset.y, offset.z);
+    MatrixStack_TranslateRel16_I(&g_MatrixStack, offset);
 }
 
 void Matrix_TranslateRel32_I(const XYZ_32 offset)
 {
-    Matrix_TranslateRel_I(offset.x, offset.y, offset.z);
+    MatrixStack_TranslateRel32_I(&g_MatrixStack, offset);
 }
 
 void Matrix_TranslateRel_ID(
     const int32_t x, const int32_t y, const int32_t z, const int32_t x2,
     const int32_t y2, const int32_t z2)
 {
-    Matrix_TranslateRel(x, y, z);
-    MATRIX *const old_matrix = g_MatrixPtr;
-    g_MatrixPtr = m_IMMatrixPtr;
-    Matrix_TranslateRel(x2, y2, z2);
-    g_MatrixPtr = old_matrix;
+    MatrixStack_TranslateRel_ID(&g_MatrixStack, x, y, z, x2, y2, z2);
 }
 
 void Matrix_TranslateRel16_ID(const XYZ_16 offset_1, const XYZ_16 offset_2)
 {
-    Matrix_TranslateRel_ID(
-        offset_1.x, offset_1.y, offset_1.z, offset_2.x, offset_2.y, offset_2.z);
+    MatrixStack_TranslateRel16_ID(&g_MatrixStack, offset_1, offset_2);
 }
 
 void Matrix_TranslateRel32_ID(const XYZ_32 offset_1, const XYZ_32 offset_2)
 {
-    Matrix_TranslateRel_ID(
-        offset_1.x, offset_1.y, offset_1.z, offset_2.x, offset_2.y, offset_2.z);
+    MatrixStack_TranslateRel32_ID(&g_MatrixStack, offset_1, offset_2);
 }
 
 void Matrix_RotY_I(const int16_t ang)
 {
-    Matrix_RotY(ang);
-    MATRIX *const old_matrix = g_MatrixPtr;
-    g_MatrixPtr = m_IMMatrixPtr;
-    Matrix_RotY(ang);
-    g_MatrixPtr = old_matrix;
+    MatrixStack_RotY_I(&g_MatrixStack, ang);
 }
 
 void Matrix_RotX_I(const int16_t ang)
 {
-    Matrix_RotX(ang);
-    MATRIX *const old_matrix = g_MatrixPtr;
-    g_MatrixPtr = m_IMMatrixPtr;
-    Matrix_RotX(ang);
-    g_MatrixPtr = old_matrix;
+    MatrixStack_RotX_I(&g_MatrixStack, ang);
 }
 
 void Matrix_RotZ_I(const int16_t ang)
 {
-    Matrix_RotZ(ang);
-    MATRIX *const old_matrix = g_MatrixPtr;
-    g_MatrixPtr = m_IMMatrixPtr;
-    Matrix_RotZ(ang);
-    g_MatrixPtr = old_matrix;
+    MatrixStack_RotZ_I(&g_MatrixStack, ang);
 }
 
 void Matrix_Rot16_I(const XYZ_16 rotation)
 {
-    M_RotYXZ_I(rotation.y, rotation.x, rotation.z);
+    MatrixStack_Rot16_I(&g_MatrixStack, rotation);
 }
 
 void Matrix_Rot16_ID(const XYZ_16 rotation_1, const XYZ_16 rotation_2)
 {
-    Matrix_Rot16(rotation_1);
-    MATRIX *const old_matrix = g_MatrixPtr;
-    g_MatrixPtr = m_IMMatrixPtr;
-    Matrix_Rot16(rotation_2);
-    g_MatrixPtr = old_matrix;
+    MatrixStack_Rot16_ID(&g_MatrixStack, rotation_1, rotation_2);
 }
 
 void Matrix_LookAt(
@@ -4,11 +4,46 @@
 #include "game/const.h"
 #include "game/game_buf.h"
 
+#include <stdlib.h>
+
+static int M_CompareMeshOffsets(const void *a, const void *b);
+static void M_IndexMeshes(void);
+
 static OBJECT m_Objects[O_NUMBER_OF] = {};
 static STATIC_OBJECT_3D m_StaticObjects3D[MAX_STATIC_OBJECTS] = {};
 static STATIC_OBJECT_2D m_StaticObjects2D[MAX_STATIC_OBJECTS] = {};
 static OBJECT_MESH **m_MeshPointers = nullptr;
 static int32_t m_MeshCount = 0;
+static int32_t *m_MeshIndex = nullptr;
+static bool m_IsMeshIndexValid = false;
+
+static int M_CompareMeshOffsets(const void *const a, const void *const b)
+{
+    const int32_t slot_a = *(const int32_t *)a;
+    const int32_t slot_b = *(const int32_t *)b;
+    const int32_t offset_a = Object_GetMeshOffset(m_MeshPointers[slot_a]);
+    const int32_t offset_b = Object_GetMeshOffset(m_MeshPointers[slot_b]);
+    if (offset_a != offset_b) {
+        return (offset_a > offset_b) - (offset_a < offset_b);
+    }
+    return (slot_a > slot_b) - (slot_a < slot_b);
+}
+
+static void M_IndexMeshes(void)
+{
+    // Offsets are only unique within one file. The level and every injection
+    // count them from their own start, so equal offsets are ordered by slot
+    // to let the first stored mesh win.
+    if (m_MeshIndex == nullptr) {
+        m_MeshIndex =
+            GameBuf_Alloc(sizeof(int32_t) * m_MeshCount, GBUF_MESH_POINTERS);
+    }
+    for (int32_t i = 0; i < m_MeshCount; i++) {
+        m_MeshIndex[i] = i;
+    }
+    qsort(m_MeshIndex, m_MeshCount, sizeof(int32_t), M_CompareMeshOffsets);
+    m_IsMeshIndexValid = true;
+}
 
 OBJECT *Object_Get(const GAME_OBJECT_ID obj_id)
 {
@@ -68,12 +103,16 @@ void Object_InitialiseMeshes(const int32_t mesh_count)
     m_MeshPointers =
         GameBuf_Alloc(sizeof(OBJECT_MESH *) * mesh_count, GBUF_MESH_POINTERS);
     m_MeshCount = 0;
+    m_MeshIndex = nullptr;
+    m_IsMeshIndexValid = false;
 }
 
 void Object_StoreMesh(OBJECT_MESH *const mesh)
 {
     m_MeshPointers[m_MeshCount] = mesh;
     m_MeshCount++;
+    m_MeshIndex = nullptr;
+    m_IsMeshIndexValid = false;
 }
 
 OBJECT_MESH *Object_GetMesh(const int32_t index)
@@ -83,13 +122,28 @@ OBJECT_MESH *Object_GetMesh(const int32_t index)
 
 OBJECT_MESH *Object_FindMesh(const int32_t data_offset)
 {
-    for (int32_t i = 0; i < m_MeshCount; i++) {
-        OBJECT_MESH *const mesh = m_MeshPointers[i];
+    if (!m_IsMeshIndexValid) {
+        M_IndexMeshes();
+    }
+
+    int32_t lo = 0;
+    int32_t hi = m_MeshCount;
+    while (lo < hi) {
+        const int32_t mid = lo + (hi - lo) / 2;
+        const OBJECT_MESH *const mesh = m_MeshPointers[m_MeshIndex[mid]];
+        if (Object_GetMeshOffset(mesh) < data_offset) {
+            lo = mid + 1;
+        } else {
+            hi = mid;
+        }
+    }
+
+    if (lo < m_MeshCount) {
+        OBJECT_MESH *const mesh = m_MeshPointers[m_MeshIndex[lo]];
         if (Object_GetMeshOffset(mesh) == data_offset) {
             return mesh;
         }
     }
-
     return nullptr;
 }
 
@@ -114,6 +168,7 @@ void Object_SwapMesh(
     m_MeshPointers[obj1->mesh_idx + mesh_num] =
         m_MeshPointers[obj2->mesh_idx + mesh_num];
     m_MeshPointers[obj2->mesh_idx + mesh_num] = temp;
+    m_IsMeshIndexValid = false;
 }
 
 ANIM *Object_GetAnim(const OBJECT *const obj, const int32_t anim_idx)
@@ -29,7 +29,12 @@ static struct {
 
 static M_NAME_ENTRY m_NamesTable[O_NUMBER_OF] = {};
 
+static bool m_FuzzyIndexDirty = true;
+static STRING_FUZZY_SOURCE_VECTOR m_FuzzySource = {};
+static STRING_FUZZY_INDEX m_FuzzyIndex = {};
+
 static void M_ClearNames(void);
+static void M_BuildFuzzyIndex(void);
 
 static void M_ClearNames(void)
 {
@@ -40,8 +45,40 @@ static void M_ClearNames(void)
     }
 }
 
+static void M_BuildFuzzyIndex(void)
+{
+    String_FuzzyIndex_Free(&m_FuzzyIndex);
+    STRING_FUZZY_SOURCE_Vector_Clear(&m_FuzzySource);
+
+    for (GAME_OBJECT_ID obj_id = 0; obj_id < O_NUMBER_OF; obj_id++) {
+        {
+            STRING_FUZZY_SOURCE source_item = {
+                .key = Object_GetName(obj_id),
+                .value = (void *)(intptr_t)obj_id,
+                .weight = 2,
+            };
+            if (source_item.key != nullptr) {
+                STRING_FUZZY_SOURCE_Vector_Push(&m_FuzzySource, source_item);
+            }
+        }
+
+        if (Object_IsType(obj_id, g_PickupObjects)) {
+            STRING_FUZZY_SOURCE source_item = {
+                .key = "pickup",
+                .value = (void *)(intptr_t)obj_id,
+                .weight = 1,
+            };
+            STRING_FUZZY_SOURCE_Vector_Push(&m_FuzzySource, source_item);
+        }
+    }
+
+    String_FuzzyIndex_Build(&m_FuzzyIndex, &m_FuzzySource);
+    m_FuzzyIndexDirty = false;
+}
+
 void Object_SetName(const GAME_OBJECT_ID obj_id, const char *const name)
 {
+    m_FuzzyIndexDirty = true;
     M_NAME_ENTRY *const entry = &m_NamesTable[obj_id];
     Memory_FreePointer(&entry->name);
     ASSERT(name != nullptr);
@@ -89,53 +126,47 @@ void Object_ResetNames(void)
 #undef OBJ_ALIAS_DEFINE
 }
 
+void Object_ShutdownNames(void)
+{
+    M_ClearNames();
+    String_FuzzyIndex_Free(&m_FuzzyIndex);
+    STRING_FUZZY_SOURCE_Vector_Free(&m_FuzzySource);
+    m_FuzzyIndexDirty = true;
+}
+
 GAME_OBJECT_ID *Object_IdsFromName(
     const char *user_input, int32_t *out_match_count,
     bool (*filter)(GAME_OBJECT_ID))
 {
-    VECTOR *source = Vector_Create(sizeof(STRING_FUZZY_SOURCE));
-
-    for (GAME_OBJECT_ID obj_id = 0; obj_id < O_NUMBER_OF; obj_id++) {
-        if (filter != nullptr && !filter(obj_id)) {
-            continue;
-        }
+    if (m_FuzzyIndexDirty) {
+        M_BuildFuzzyIndex();
+    }
 
-        {
-            STRING_FUZZY_SOURCE source_item = {
-                .key = Object_GetName(obj_id),
-                .value = (void *)(intptr_t)obj_id,
-                .weight = 2,
-            };
-            if (source_item.key != nullptr) {
-                Vector_Add(source, &source_item);
+    STRING_FUZZY_SOURCE_VECTOR source = {};
+    String_FuzzyIndex_Filter(&m_FuzzyIndex, user_input, &source);
+    if (filter != nullptr) {
+        for (int32_t i = source.count - 1; i >= 0; i--) {
+            const GAME_OBJECT_ID obj_id =
+                (GAME_OBJECT_ID)(intptr_t)source.items[i].value;
+            if (!filter(obj_id)) {
+                STRING_FUZZY_SOURCE_Vector_RemoveAt(&source, i);
             }
         }
-
-        if (Object_IsType(obj_id, g_PickupObjects)) {
-            STRING_FUZZY_SOURCE source_item = {
-                .key = "pickup",
-                .value = (void *)(intptr_t)obj_id,
-                .weight = 1,
-            };
-            Vector_Add(source, &source_item);
-        }
     }
 
-    VECTOR *matches = String_FuzzyMatch(user_input, source);
+    STRING_FUZZY_MATCH_VECTOR matches = String_FuzzyMatch(user_input, &source);
     GAME_OBJECT_ID *results =
-        Memory_Alloc(sizeof(GAME_OBJECT_ID) * (matches->count + 1));
-    for (int32_t i = 0; i < matches->count; i++) {
-        const STRING_FUZZY_MATCH *const match = Vector_Get(matches, i);
-        results[i] = (GAME_OBJECT_ID)(intptr_t)match->value;
+        Memory_Alloc(sizeof(GAME_OBJECT_ID) * (matches.count + 1));
+    for (int32_t i = 0; i < matches.count; i++) {
+        results[i] = (GAME_OBJECT_ID)(intptr_t)matches.items[i].value;
     }
-    results[matches->count] = NO_OBJECT;
+    results[matches.count] = NO_OBJECT;
     if (out_match_count != nullptr) {
-        *out_match_count = matches->count;
+        *out_match_count = matches.count;
     }
 
-    Vector_Free(matches);
-    Vector_Free(source);
-    matches = nullptr;
+    STRING_FUZZY_MATCH_Vector_Free(&matches);
+    STRING_FUZZY_SOURCE_Vector_Free(&source);
 
     return results;
 }
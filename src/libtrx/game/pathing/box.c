@@ -1,6 +1,8 @@
 #include "game/game_buf.h"
 #include "game/pathing.h"
 #include "game/rooms.h"
+#include "memory.h"
+#include "utils.h"
 
 static int32_t m_BoxCount = 0;
 static BOX_INFO *m_Boxes = nullptr;
@@ -8,9 +10,110 @@ static int16_t *m_Overlaps = nullptr;
 static int16_t *m_FlyZone[2] = {};
 static int16_t *m_GroundZone[MAX_ZONES][2] = {};
 
+// Boxes grouped by zone number, built lazily per zone table. Lets LOT setup
+// enumerate a zone without scanning every box in the level.
+typedef struct {
+    bool is_built;
+    int32_t zone_count;
+    int32_t *offsets;
+    int16_t *boxes;
+} BOX_ZONE_INDEX;
+
+static BOX_ZONE_INDEX m_FlyZoneIndex[2] = {};
+static BOX_ZONE_INDEX m_GroundZoneIndex[MAX_ZONES][2] = {};
+
+static void M_BuildZoneIndex(
+    BOX_ZONE_INDEX *index, const int16_t *zone, GAME_BUFFER buffer);
+static const BOX_ZONE_INDEX *M_GetZoneIndex(
+    const LOT_INFO *lot, bool flip_status);
+static int32_t M_GetZoneBoxes(
+    const BOX_ZONE_INDEX *index, int16_t zone_num, const int16_t **out_boxes);
+
+static void M_BuildZoneIndex(
+    BOX_ZONE_INDEX *const index, const int16_t *const zone,
+    const GAME_BUFFER buffer)
+{
+    index->is_built = true;
+    index->zone_count = 0;
+    index->offsets = nullptr;
+    index->boxes = nullptr;
+
+    int32_t max_zone_num = -1;
+    for (int32_t i = 0; i < m_BoxCount; i++) {
+        if (zone[i] < 0) {
+            // Not something we can bucket; callers fall back to a full scan.
+            return;
+        }
+        max_zone_num = MAX(max_zone_num, zone[i]);
+    }
+
+    index->zone_count = max_zone_num + 1;
+    index->offsets =
+        GameBuf_Alloc(sizeof(int32_t) * (index->zone_count + 1), buffer);
+    index->boxes = GameBuf_Alloc(sizeof(int16_t) * m_BoxCount, buffer);
+
+    for (int32_t i = 0; i <= index->zone_count; i++) {
+        index->offsets[i] = 0;
+    }
+    for (int32_t i = 0; i < m_BoxCount; i++) {
+        index->offsets[zone[i] + 1]++;
+    }
+    for (int32_t i = 0; i < index->zone_count; i++) {
+        index->offsets[i + 1] += index->offsets[i];
+    }
+
+    // Walking the boxes in order keeps every bucket sorted by box number.
+    int32_t *const fill = Memory_Alloc(sizeof(int32_t) * index->zone_count);
+    for (int32_t i = 0; i < index->zone_count; i++) {
+        fill[i] = index->offsets[i];
+    }
+    for (int32_t i = 0; i < m_BoxCount; i++) {
+        index->boxes[fill[zone[i]]++] = i;
+    }
+    Memory_Free(fill);
+}
+
+static const BOX_ZONE_INDEX *M_GetZoneIndex(
+    const LOT_INFO *const lot, const bool flip_status)
+{
+    if (lot->fly) {
+        BOX_ZONE_INDEX *const index = &m_FlyZoneIndex[flip_status];
+        if (!index->is_built) {
+            M_BuildZoneIndex(index, m_FlyZone[flip_status], GBUF_FLY_ZONE);
+        }
+        return index;
+    }
+
+    const int32_t zone_idx = BOX_ZONE(lot->step);
+    BOX_ZONE_INDEX *const index = &m_GroundZoneIndex[zone_idx][flip_status];
+    if (!index->is_built) {
+        M_BuildZoneIndex(
+            index, m_GroundZone[zone_idx][flip_status], GBUF_GROUND_ZONE);
+    }
+    return index;
+}
+
+static int32_t M_GetZoneBoxes(
+    const BOX_ZONE_INDEX *const index, const int16_t zone_num,
+    const int16_t **const out_boxes)
+{
+    if (zone_num < 0 || zone_num >= index->zone_count) {
+        *out_boxes = nullptr;
+        return 0;
+    }
+    *out_boxes = &index->boxes[index->offsets[zone_num]];
+    return index->offsets[zone_num + 1] - index->offsets[zone_num];
+}
+
 void Box_InitialiseBoxes(const int32_t num_boxes)
 {
     m_BoxCount = num_boxes;
+    for (int32_t i = 0; i < 2; i++) {
+        m_FlyZoneIndex[i].is_built = false;
+        for (int32_t j = 0; j < MAX_ZONES; j++) {
+            m_GroundZoneIndex[j][i].is_built = false;
+        }
+    }
     m_Boxes = num_boxes == 0
         ? nullptr
         : GameBuf_Alloc(sizeof(BOX_INFO) * num_boxes, GBUF_BOXES);
@@ -68,3 +171,59 @@ int16_t *Box_GetLotZone(const LOT_INFO *const lot)
     return lot->fly ? Box_GetFlyZone(flip_status)
                     : Box_GetGroundZone(flip_status, BOX_ZONE(lot->step));
 }
+
+void Box_FillZone(LOT_INFO *const lot, const int16_t box_num)
+{
+    const int16_t *zone;
+    const int16_t *flip;
+    if (lot->fly) {
+        zone = Box_GetFlyZone(false);
+        flip = Box_GetFlyZone(true);
+    } else {
+        zone = Box_GetGroundZone(false, BOX_ZONE(lot->step));
+        flip = Box_GetGroundZone(true, BOX_ZONE(lot->step));
+    }
+
+    const int16_t zone_num = zone[box_num];
+    const int16_t flip_num = flip[box_num];
+
+    const BOX_ZONE_INDEX *const zone_index = M_GetZoneIndex(lot, false);
+    const BOX_ZONE_INDEX *const flip_index = M_GetZoneIndex(lot, true);
+    lot->zone_count = 0;
+
+    if (zone_index->boxes == nullptr || flip_index->boxes == nullptr) {
+        for (int32_t i = 0; i < m_BoxCount; i++) {
+            if (zone[i] == zone_num || flip[i] == flip_num) {
+                lot->node[lot->zone_count++].box_num = i;
+            }
+        }
+        return;
+    }
+
+    // Merge both sorted buckets, so that the result matches a linear scan of
+    // all boxes exactly.
+    const int16_t *zone_boxes;
+    const int16_t *flip_boxes;
+    const int32_t zone_box_count =
+        M_GetZoneBoxes(zone_index, zone_num, &zone_boxes);
+    const int32_t flip_box_count =
+        M_GetZoneBoxes(flip_index, flip_num, &flip_boxes);
+    int32_t i = 0;
+    int32_t j = 0;
+    while (i < zone_box_count || j < flip_box_count) {
+        int16_t next_box;
+        if (j == flip_box_count) {
+            next_box = zone_boxes[i++];
+        } else if (i == zone_box_count) {
+            next_box = flip_boxes[j++];
+        } else if (zone_boxes[i] < flip_boxes[j]) {
+            next_box = zone_boxes[i++];
+        } else if (flip_boxes[j] < zone_boxes[i]) {
+            next_box = flip_boxes[j++];
+        } else {
+            next_box = zone_boxes[i++];
+            j++;
+        }
+        lot->node[lot->zone_count++].box_num = next_box;
+    }
+}
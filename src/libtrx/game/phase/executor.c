@@ -11,8 +11,15 @@
 #include "game/savegame.h"
 #include "game/shell.h"
 #include "game/text.h"
+#include "memory.h"
+#include "utils.h"
+
+#include <math.h>
 
 #define MAX_PHASES 10
+#define INTERPOLATION_EPSILON 1e-6
+// Logic ticks run at most this many at once to catch up after a stall.
+#define MAX_CATCHUP_TICKS 4
 
 static bool m_Exiting;
 static FADER m_ExitFader;
@@ -22,6 +29,8 @@ static PHASE *m_PhaseStack[MAX_PHASES] = {};
 static PHASE_CONTROL M_Control(PHASE *phase, int32_t nframes);
 static void M_Draw(PHASE *phase);
 static int32_t M_Wait(PHASE *phase);
+static double M_DrawInterpolated(
+    PHASE *phase, double next_ratio, int32_t *out_nticks);
 
 static PHASE_CONTROL M_Control(PHASE *const phase, const int32_t nframes)
 {
@@ -71,6 +80,7 @@ static void M_Draw(PHASE *const phase)
     Fader_Draw(&m_ExitFader);
 
     Output_EndScene();
+    Memory_FrameReset();
 }
 
 static int32_t M_Wait(PHASE *const phase)
@@ -82,6 +92,43 @@ static int32_t M_Wait(PHASE *const phase)
     }
 }
 
+// Draws every display frame that falls within the logic tick that was just
+// run. Each frame is interpolated between the previous and the current tick
+// according to how far into the tick it is shown, so display rates that are
+// not a multiple of the logic rate still advance at an even pace. Reports the
+// number of logic ticks to run next, and returns the position of the next
+// frame relative to the last of them.
+static double M_DrawInterpolated(
+    PHASE *const phase, double next_ratio, int32_t *const out_nticks)
+{
+    const double step = (double)LOGIC_FPS / Clock_GetCurrentFPS();
+    if (next_ratio <= 0.0) {
+        next_ratio = step;
+    }
+
+    while (next_ratio <= 1.0 + INTERPOLATION_EPSILON) {
+        Interpolation_SetRate(MIN(next_ratio, 1.0));
+        M_Draw(phase);
+        // Frames that were missed still count towards the tick, so that a
+        // slow frame does not stretch the logic tick.
+        next_ratio += step * MAX(M_Wait(phase), 1);
+    }
+
+    // The wait is counted in display frames, while the phases expect logic
+    // ticks. Run as many ticks as it takes for the next frame to fall within
+    // the last one, which is usually just one.
+    const int32_t nticks =
+        (int32_t)ceil(next_ratio - INTERPOLATION_EPSILON) - 1;
+    if (nticks > MAX_CATCHUP_TICKS) {
+        // After a long stall drop the excess time, and show the next tick as
+        // soon as it is ready.
+        *out_nticks = MAX_CATCHUP_TICKS;
+        return 1.0;
+    }
+    *out_nticks = nticks;
+    return next_ratio - nticks;
+}
+
 GF_COMMAND PhaseExecutor_Run(PHASE *const phase)
 {
     GF_COMMAND gf_cmd = { .action = GF_NOOP };
@@ -107,6 +154,7 @@ GF_COMMAND PhaseExecutor_Run(PHASE *const phase)
     }
 
     int32_t nframes = Clock_WaitTick();
+    double next_ratio = 0.0;
     while (true) {
         const PHASE_CONTROL control = M_Control(phase, nframes);
 
@@ -120,17 +168,13 @@ GF_COMMAND PhaseExecutor_Run(PHASE *const phase)
         } else if (control.action == PHASE_ACTION_NO_WAIT) {
             nframes = 0;
             continue;
+        } else if (Interpolation_IsEnabled()) {
+            next_ratio = M_DrawInterpolated(phase, next_ratio, &nframes);
         } else {
-            nframes = 0;
-            if (Interpolation_IsEnabled()) {
-                Interpolation_SetRate(0.5);
-                M_Draw(phase);
-                M_Wait(phase);
-            }
-
+            next_ratio = 0.0;
             Interpolation_SetRate(1.0);
             M_Draw(phase);
-            nframes += M_Wait(phase);
+            nframes = M_Wait(phase);
         }
     }
 
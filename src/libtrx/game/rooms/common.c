@@ -4,6 +4,7 @@
 #include "game/camera.h"
 #include "game/const.h"
 #include "game/game_buf.h"
+#include "game/item_grid.h"
 #include "game/items.h"
 #include "game/objects/common.h"
 #include "game/rooms/const.h"
@@ -41,6 +42,7 @@ static const int16_t *M_ReadTrigger(
     const int16_t *data, int16_t fd_entry, SECTOR *sector);
 static void M_AddFlipItems(const ROOM *room);
 static void M_RemoveFlipItems(const ROOM *room);
+static void M_MarkDynamicSector(SECTOR *sector);
 static int16_t M_GetFloorTiltHeight(const SECTOR *sector, int32_t x, int32_t z);
 static int16_t M_GetCeilingTiltHeight(
     const SECTOR *sector, int32_t x, int32_t z);
@@ -152,6 +154,31 @@ static void M_RemoveFlipItems(const ROOM *const room)
     }
 }
 
+static void M_MarkDynamicSector(SECTOR *const sector)
+{
+    sector->floor.is_dynamic = false;
+    sector->ceiling.is_dynamic = false;
+    if (sector->trigger == nullptr) {
+        return;
+    }
+
+    const TRIGGER_CMD *cmd = sector->trigger->command;
+    for (; cmd != nullptr; cmd = cmd->next_cmd) {
+        if (cmd->type != TO_OBJECT) {
+            continue;
+        }
+
+        const ITEM *const item = Item_Get((int16_t)(intptr_t)cmd->parameter);
+        const OBJECT *const obj = Object_Get(item->object_id);
+        if (obj->floor_height_func != nullptr) {
+            sector->floor.is_dynamic = true;
+        }
+        if (obj->ceiling_height_func != nullptr) {
+            sector->ceiling.is_dynamic = true;
+        }
+    }
+}
+
 static int16_t M_GetFloorTiltHeight(
     const SECTOR *const sector, const int32_t x, const int32_t z)
 {
@@ -286,6 +313,7 @@ void Room_FlipMap(void)
         M_AddFlipItems(room);
     }
 
+    ItemGrid_Invalidate();
     m_FlipStatus = !m_FlipStatus;
 }
 
@@ -347,6 +375,8 @@ void Room_PopulateSectorData(
 {
     sector->floor.tilt = 0;
     sector->ceiling.tilt = 0;
+    sector->floor.is_dynamic = false;
+    sector->ceiling.is_dynamic = false;
     sector->portal_room.wall = NO_ROOM;
     sector->is_death_sector = false;
     sector->trigger = nullptr;
@@ -394,6 +424,21 @@ void Room_PopulateSectorData(
             break;
         }
     } while (!FD_IS_DONE(fd_entry));
+
+    // Objects may not be set up yet, so assume any trigger can alter the
+    // height until Room_MarkDynamicSectors narrows it down.
+    sector->floor.is_dynamic = sector->trigger != nullptr;
+    sector->ceiling.is_dynamic = sector->trigger != nullptr;
+}
+
+void Room_MarkDynamicSectors(void)
+{
+    for (int32_t i = 0; i < Room_GetCount(); i++) {
+        const ROOM *const room = Room_Get(i);
+        for (int32_t j = 0; j < room->size.x * room->size.z; j++) {
+            M_MarkDynamicSector(&room->sectors[j]);
+        }
+    }
 }
 
 int32_t Room_GetAdjoiningRooms(
@@ -544,7 +589,7 @@ int16_t Room_GetHeight(
         height = M_GetFloorTiltHeight(pit_sector, x, z);
     }
 
-    if (pit_sector->trigger == nullptr) {
+    if (!pit_sector->floor.is_dynamic) {
         return height;
     }
 
@@ -572,7 +617,7 @@ int16_t Room_GetCeiling(
     int16_t height = M_GetCeilingTiltHeight(sky_sector, x, z);
 
     const SECTOR *const pit_sector = Room_GetPitSector(sector, x, z);
-    if (pit_sector->trigger == nullptr) {
+    if (!pit_sector->ceiling.is_dynamic) {
         return height;
     }
 
@@ -1,8 +1,78 @@
 #include "game/savegame.h"
 
+#include "filesystem.h"
 #include "log.h"
+#include "memory.h"
+#include "vector.h"
+
+#include <SDL2/SDL_error.h>
+#include <SDL2/SDL_mutex.h>
+#include <SDL2/SDL_thread.h>
+
+typedef struct M_WRITE_JOB {
+    int32_t slot_num;
+    char *path;
+    char *data;
+    size_t size;
+    SAVEGAME_ENCODE_FUNC encode;
+    struct M_WRITE_JOB *next;
+} M_WRITE_JOB;
 
 static int32_t m_BoundSlot = -1;
+static SDL_mutex *m_WriteLock = nullptr;
+static SDL_cond *m_WriteDone = nullptr;
+static M_WRITE_JOB *m_PendingWrites = nullptr;
+// Slots whose most recent write did not make it to the disk.
+static VECTOR *m_FailedSlots = nullptr;
+
+static bool M_IsSlotBusy(int32_t slot_num);
+static void M_RunWriteJob(M_WRITE_JOB *job);
+static int M_WriteThread(void *arg);
+
+static bool M_IsSlotBusy(const int32_t slot_num)
+{
+    for (const M_WRITE_JOB *job = m_PendingWrites; job != nullptr;
+         job = job->next) {
+        if (job->slot_num == slot_num) {
+            return true;
+        }
+    }
+    return false;
+}
+
+static void M_RunWriteJob(M_WRITE_JOB *const job)
+{
+    bool is_written = false;
+    if (job->encode != nullptr && !job->encode(&job->data, &job->size)) {
+        LOG_ERROR("Failed to encode savegame %s", job->path);
+    } else if (File_WriteAtomic(job->path, job->data, job->size)) {
+        LOG_DEBUG("Saved slot %d to %s", job->slot_num, job->path);
+        is_written = true;
+    }
+
+    SDL_LockMutex(m_WriteLock);
+    Vector_Remove(m_FailedSlots, &job->slot_num);
+    if (!is_written) {
+        Vector_Add(m_FailedSlots, &job->slot_num);
+    }
+    M_WRITE_JOB **link = &m_PendingWrites;
+    while (*link != job) {
+        link = &(*link)->next;
+    }
+    *link = job->next;
+    SDL_CondBroadcast(m_WriteDone);
+    SDL_UnlockMutex(m_WriteLock);
+
+    Memory_FreePointer(&job->path);
+    Memory_FreePointer(&job->data);
+    Memory_Free(job);
+}
+
+static int M_WriteThread(void *const arg)
+{
+    M_RunWriteJob(arg);
+    return 0;
+}
 
 void Savegame_BindSlot(const int32_t slot_num)
 {
@@ -20,3 +90,92 @@ int32_t Savegame_GetBoundSlot(void)
 {
     return m_BoundSlot;
 }
+
+void Savegame_WriteAsync(
+    const int32_t slot_num, const char *const path, char *const data,
+    const size_t size, const SAVEGAME_ENCODE_FUNC encode)
+{
+    if (m_WriteLock == nullptr) {
+        m_WriteLock = SDL_CreateMutex();
+        m_WriteDone = SDL_CreateCond();
+        m_FailedSlots = Vector_Create(sizeof(int32_t));
+    }
+
+    // Only one write per slot may be in flight, so that an older save never
+    // lands on top of a newer one.
+    Savegame_WaitForSlot(slot_num);
+
+    M_WRITE_JOB *const job = Memory_Alloc(sizeof(M_WRITE_JOB));
+    job->slot_num = slot_num;
+    job->path = Memory_DupStr(path);
+    job->data = data;
+    job->size = size;
+    job->encode = encode;
+
+    SDL_LockMutex(m_WriteLock);
+    job->next = m_PendingWrites;
+    m_PendingWrites = job;
+    SDL_UnlockMutex(m_WriteLock);
+
+    SDL_Thread *const thread =
+        SDL_CreateThread(M_WriteThread, "savegame_write", job);
+    if (thread == nullptr) {
+        LOG_ERROR("SDL_CreateThread(): %s", SDL_GetError());
+        M_RunWriteJob(job);
+        return;
+    }
+    SDL_DetachThread(thread);
+}
+
+bool Savegame_IsSlotBusy(const int32_t slot_num)
+{
+    if (m_WriteLock == nullptr) {
+        return false;
+    }
+
+    SDL_LockMutex(m_WriteLock);
+    const bool result = M_IsSlotBusy(slot_num);
+    SDL_UnlockMutex(m_WriteLock);
+    return result;
+}
+
+void Savegame_WaitForSlot(const int32_t slot_num)
+{
+    if (m_WriteLock == nullptr) {
+        return;
+    }
+
+    SDL_LockMutex(m_WriteLock);
+    while (M_IsSlotBusy(slot_num)) {
+        SDL_CondWait(m_WriteDone, m_WriteLock);
+    }
+    SDL_UnlockMutex(m_WriteLock);
+}
+
+bool Savegame_DidWriteFail(const int32_t slot_num)
+{
+    if (m_WriteLock == nullptr) {
+        return false;
+    }
+
+    SDL_LockMutex(m_WriteLock);
+    while (M_IsSlotBusy(slot_num)) {
+        SDL_CondWait(m_WriteDone, m_WriteLock);
+    }
+    const bool result = Vector_Contains(m_FailedSlots, &slot_num);
+    SDL_UnlockMutex(m_WriteLock);
+    return result;
+}
+
+void Savegame_WaitForWrites(void)
+{
+    if (m_WriteLock == nullptr) {
+        return;
+    }
+
+    SDL_LockMutex(m_WriteLock);
+    while (m_PendingWrites != nullptr) {
+        SDL_CondWait(m_WriteDone, m_WriteLock);
+    }
+    SDL_UnlockMutex(m_WriteLock);
+}
@@ -83,6 +83,7 @@ void Text_Shutdown(void)
         TEXTSTRING *const text = &m_TextStrings[i];
         Memory_FreePointer(&text->content);
         Memory_FreePointer(&text->glyphs);
+        Memory_FreePointer(&text->layout.sprites);
     }
 
     M_HASH_ENTRY *current, *tmp;
@@ -136,6 +137,9 @@ TEXTSTRING *Text_Create(int16_t x, int16_t y, const char *const content)
     TEXTSTRING *text = &m_TextStrings[free_idx];
     text->content = nullptr;
     text->glyphs = nullptr;
+    text->layout.is_dirty = true;
+    text->layout.sprite_count = 0;
+    text->layout.sprites = nullptr;
     text->scale.h = TEXT_BASE_SCALE;
     text->scale.v = TEXT_BASE_SCALE;
     text->pos.x = x;
@@ -166,6 +170,8 @@ void Text_Remove(TEXTSTRING *const text)
         text->flags.active = 0;
         Memory_FreePointer(&text->content);
         Memory_FreePointer(&text->glyphs);
+        Memory_FreePointer(&text->layout.sprites);
+        text->layout.sprite_count = 0;
     }
 }
 
@@ -176,11 +182,19 @@ void Text_ChangeText(TEXTSTRING *const text, const char *const content)
     }
 
     ASSERT(content != nullptr);
+    if (text->flags.active && text->content != nullptr
+        && strcmp(text->content, content) == 0) {
+        // Most callers refresh their labels every frame; avoid rebuilding the
+        // glyph list if nothing has changed.
+        return;
+    }
+
     Memory_FreePointer(&text->content);
     Memory_FreePointer(&text->glyphs);
     if (!text->flags.active) {
         return;
     }
+    text->layout.is_dirty = true;
 
     // Count number of characters
     size_t glyph_count = 0;
@@ -228,8 +242,11 @@ void Text_SetPos(TEXTSTRING *const text, int16_t x, int16_t y)
     if (text == nullptr) {
         return;
     }
-    text->pos.x = x;
-    text->pos.y = y;
+    if (text->pos.x != x || text->pos.y != y) {
+        text->pos.x = x;
+        text->pos.y = y;
+        text->layout.is_dirty = true;
+    }
 }
 
 void Text_SetScale(
@@ -238,8 +255,11 @@ void Text_SetScale(
     if (text == nullptr) {
         return;
     }
-    text->scale.h = scale_h;
-    text->scale.v = scale_v;
+    if (text->scale.h != scale_h || text->scale.v != scale_v) {
+        text->scale.h = scale_h;
+        text->scale.v = scale_v;
+        text->layout.is_dirty = true;
+    }
 }
 
 void Text_Flash(TEXTSTRING *const text, const bool enable, const int16_t rate)
@@ -286,6 +306,7 @@ void Text_AddBackground(
         break;
     }
     text->background.style = style;
+    text->layout.is_dirty = true;
 }
 
 void Text_RemoveBackground(TEXTSTRING *const text)
@@ -318,7 +339,10 @@ void Text_CentreH(TEXTSTRING *const text, const bool enable)
     if (text == nullptr) {
         return;
     }
-    text->flags.centre_h = enable;
+    if (text->flags.centre_h != enable) {
+        text->flags.centre_h = enable;
+        text->layout.is_dirty = true;
+    }
 }
 
 void Text_CentreV(TEXTSTRING *const text, const bool enable)
@@ -326,7 +350,10 @@ void Text_CentreV(TEXTSTRING *const text, const bool enable)
     if (text == nullptr) {
         return;
     }
-    text->flags.centre_v = enable;
+    if (text->flags.centre_v != enable) {
+        text->flags.centre_v = enable;
+        text->layout.is_dirty = true;
+    }
 }
 
 void Text_AlignRight(TEXTSTRING *const text, const bool enable)
@@ -334,7 +361,10 @@ void Text_AlignRight(TEXTSTRING *const text, const bool enable)
     if (text == nullptr) {
         return;
     }
-    text->flags.right = enable;
+    if (text->flags.right != enable) {
+        text->flags.right = enable;
+        text->layout.is_dirty = true;
+    }
 }
 
 void Text_AlignBottom(TEXTSTRING *const text, const bool enable)
@@ -342,7 +372,10 @@ void Text_AlignBottom(TEXTSTRING *const text, const bool enable)
     if (text == nullptr) {
         return;
     }
-    text->flags.bottom = enable;
+    if (text->flags.bottom != enable) {
+        text->flags.bottom = enable;
+        text->layout.is_dirty = true;
+    }
 }
 
 void Text_SetMultiline(TEXTSTRING *const text, const bool enable)
@@ -350,7 +383,10 @@ void Text_SetMultiline(TEXTSTRING *const text, const bool enable)
     if (text == nullptr) {
         return;
     }
-    text->flags.multiline = enable;
+    if (text->flags.multiline != enable) {
+        text->flags.multiline = enable;
+        text->layout.is_dirty = true;
+    }
 }
 
 int32_t Text_GetWidth(const TEXTSTRING *const text)
@@ -1,8 +1,13 @@
 #include "game/ui/widgets/stack.h"
 
 #include "memory.h"
+#include "typed_vector.h"
 #include "utils.h"
-#include "vector.h"
+
+// Most stacks only hold a handful of widgets.
+#define UI_STACK_INLINE_CHILDREN 8
+
+DECLARE_SMALL_VECTOR(UI_WIDGET_PTR, UI_WIDGET *, UI_STACK_INLINE_CHILDREN)
 
 typedef struct {
     UI_WIDGET_VTABLE vtable;
@@ -16,7 +21,7 @@ typedef struct {
     int32_t x;
     int32_t y;
     UI_STACK_LAYOUT layout;
-    VECTOR *children;
+    UI_WIDGET_PTR_VECTOR children;
 } UI_STACK;
 
 static int32_t M_GetChildrenWidth(const UI_STACK *self);
@@ -31,9 +36,8 @@ static void M_Free(UI_STACK *self);
 static int32_t M_GetChildrenWidth(const UI_STACK *const self)
 {
     int32_t result = 0;
-    for (int32_t i = 0; i < self->children->count; i++) {
-        const UI_WIDGET *const child =
-            *(UI_WIDGET **)Vector_Get(self->children, i);
+    for (int32_t i = 0; i < self->children.count; i++) {
+        const UI_WIDGET *const child = self->children.items[i];
         switch (self->layout) {
         case UI_STACK_LAYOUT_HORIZONTAL:
             result += child->get_width(child);
@@ -49,9 +53,8 @@ static int32_t M_GetChildrenWidth(const UI_STACK *const self)
 static int32_t M_GetChildrenHeight(const UI_STACK *const self)
 {
     int32_t result = 0;
-    for (int32_t i = 0; i < self->children->count; i++) {
-        const UI_WIDGET *const child =
-            *(UI_WIDGET **)Vector_Get(self->children, i);
+    for (int32_t i = 0; i < self->children.count; i++) {
+        const UI_WIDGET *const child = self->children.items[i];
         switch (self->layout) {
         case UI_STACK_LAYOUT_HORIZONTAL:
             result = MAX(result, child->get_height(child));
@@ -96,8 +99,8 @@ static void M_SetPosition(
 
 static void M_Control(UI_STACK *const self)
 {
-    for (int32_t i = 0; i < self->children->count; i++) {
-        UI_WIDGET *const child = *(UI_WIDGET **)Vector_Get(self->children, i);
+    for (int32_t i = 0; i < self->children.count; i++) {
+        UI_WIDGET *const child = self->children.items[i];
         if (child->control != nullptr) {
             child->control(child);
         }
@@ -109,8 +112,8 @@ static void M_Draw(UI_STACK *const self)
     if (self->vtable.is_hidden) {
         return;
     }
-    for (int32_t i = 0; i < self->children->count; i++) {
-        UI_WIDGET *const child = *(UI_WIDGET **)Vector_Get(self->children, i);
+    for (int32_t i = 0; i < self->children.count; i++) {
+        UI_WIDGET *const child = self->children.items[i];
         if (child->draw != nullptr) {
             child->draw(child);
         }
@@ -119,20 +122,20 @@ static void M_Draw(UI_STACK *const self)
 
 static void M_Free(UI_STACK *const self)
 {
-    Vector_Free(self->children);
+    UI_WIDGET_PTR_Vector_Free(&self->children);
     Memory_Free(self);
 }
 
 void UI_Stack_ClearChildren(UI_WIDGET *const widget)
 {
     UI_STACK *const self = (UI_STACK *)widget;
-    Vector_Clear(self->children);
+    UI_WIDGET_PTR_Vector_Clear(&self->children);
 }
 
 void UI_Stack_AddChild(UI_WIDGET *const widget, UI_WIDGET *const child)
 {
     UI_STACK *const self = (UI_STACK *)widget;
-    Vector_Add(self->children, (void *)&child);
+    UI_WIDGET_PTR_Vector_Push(&self->children, child);
 }
 
 UI_WIDGET *UI_Stack_Create(
@@ -153,7 +156,7 @@ UI_WIDGET *UI_Stack_Create(
     self->width = width;
     self->height = height;
     self->layout = layout;
-    self->children = Vector_Create(sizeof(UI_WIDGET *));
+    UI_WIDGET_PTR_Vector_Init(&self->children);
     return (UI_WIDGET *)self;
 }
 
@@ -192,23 +195,23 @@ void UI_Stack_DoLayout(UI_WIDGET *const widget)
 
     int32_t spacing_h = 0;
     int32_t remainder_h = 0;
-    if (self->children->count > 1 && self->layout == UI_STACK_LAYOUT_HORIZONTAL
+    if (self->children.count > 1 && self->layout == UI_STACK_LAYOUT_HORIZONTAL
         && self->align.h == UI_STACK_H_ALIGN_DISTRIBUTE
         && self_width > children_width) {
-        spacing_h = (self_width - children_width) / (self->children->count - 1);
+        spacing_h = (self_width - children_width) / (self->children.count - 1);
         remainder_h =
-            (self_width - children_width) % (self->children->count - 1);
+            (self_width - children_width) % (self->children.count - 1);
     }
 
     int32_t spacing_v = 0;
     int32_t remainder_v = 0;
-    if (self->children->count > 1 && self->layout == UI_STACK_LAYOUT_VERTICAL
+    if (self->children.count > 1 && self->layout == UI_STACK_LAYOUT_VERTICAL
         && self->align.v == UI_STACK_V_ALIGN_DISTRIBUTE
         && self_height > children_height) {
         spacing_v =
-            (self_height - children_height) / (self->children->count - 1);
+            (self_height - children_height) / (self->children.count - 1);
         remainder_v =
-            (self_height - children_height) % (self->children->count - 1);
+            (self_height - children_height) % (self->children.count - 1);
     }
 
     switch (self->layout) {
@@ -224,7 +227,7 @@ void UI_Stack_DoLayout(UI_WIDGET *const widget)
             x = self->x + self_width - children_width;
             break;
         case UI_STACK_H_ALIGN_DISTRIBUTE:
-            if (self->children->count == 1) {
+            if (self->children.count == 1) {
                 x = self->x + (self_width - children_width) / 2;
             } else {
                 x = self->x;
@@ -251,8 +254,8 @@ void UI_Stack_DoLayout(UI_WIDGET *const widget)
         break;
     }
 
-    for (int32_t i = 0; i < self->children->count; i++) {
-        UI_WIDGET *const child = *(UI_WIDGET **)Vector_Get(self->children, i);
+    for (int32_t i = 0; i < self->children.count; i++) {
+        UI_WIDGET *const child = self->children.items[i];
         const int32_t child_width = child->get_width(child);
         const int32_t child_height = child->get_height(child);
 
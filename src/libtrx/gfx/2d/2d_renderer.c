@@ -10,6 +10,10 @@
 #include <GL/glew.h>
 #include <string.h>
 
+// Number of pixel unpack buffers to cycle through, so that filling one never
+// has to wait for the driver to finish reading the previous ones.
+#define M_PBO_COUNT 3
+
 typedef enum {
     M_UNIFORM_TEXTURE_MAIN,
     M_UNIFORM_TEXTURE_PALETTE,
@@ -33,6 +37,11 @@ typedef struct {
     } uv;
 } M_VERTEX;
 
+typedef struct {
+    bool is_valid;
+    uint64_t value;
+} M_CONTENT_HASH;
+
 struct GFX_2D_RENDERER {
     GFX_GL_VERTEX_ARRAY vertex_format;
     GFX_GL_BUFFER surface_buffer;
@@ -40,12 +49,16 @@ struct GFX_2D_RENDERER {
     GFX_GL_TEXTURE palette_texture;
     GFX_GL_TEXTURE alpha_texture;
     GFX_GL_PROGRAM program;
+    GFX_GL_BUFFER pbo[M_PBO_COUNT];
+    int32_t pbo_idx;
 
     M_VERTEX *vertices;
     int32_t vertex_count;
 
     GFX_2D_SURFACE_DESC desc;
     GFX_2D_SURFACE_DESC alpha_desc;
+    M_CONTENT_HASH hash;
+    M_CONTENT_HASH alpha_hash;
     struct {
         int32_t x;
         int32_t y;
@@ -102,6 +115,117 @@ static void M_UploadVertices(GFX_2D_RENDERER *const r)
         r->vertices, GL_STATIC_DRAW);
 }
 
+static uint64_t M_HashData(const uint8_t *const data, const size_t size)
+{
+    // FNV-1a over 64-bit words. It only has to tell apart consecutive frames
+    // of the same surface, so it does not need to be particularly strong.
+    uint64_t hash = 0xCBF29CE484222325;
+    size_t i = 0;
+    for (; i + sizeof(uint64_t) <= size; i += sizeof(uint64_t)) {
+        uint64_t word;
+        memcpy(&word, &data[i], sizeof(uint64_t));
+        hash = (hash ^ word) * 0x100000001B3;
+    }
+    for (; i < size; i++) {
+        hash = (hash ^ data[i]) * 0x100000001B3;
+    }
+    return hash;
+}
+
+static void M_UploadRect(
+    GFX_2D_RENDERER *const r, const GFX_2D_SURFACE_DESC *const desc,
+    const uint8_t *const data, const GFX_2D_RECT *const rect)
+{
+    const int32_t pixel_size = desc->bit_count / 8;
+    const int32_t src_stride = desc->width * pixel_size;
+    const int32_t row_size = rect->w * pixel_size;
+    const uint8_t *src = &data[rect->y * src_stride + rect->x * pixel_size];
+
+    GFX_GL_BUFFER *const pbo = &r->pbo[r->pbo_idx];
+    r->pbo_idx = (r->pbo_idx + 1) % M_PBO_COUNT;
+
+    GFX_GL_Buffer_Bind(pbo);
+    // Orphan the old storage rather than waiting for it to be consumed.
+    GFX_GL_Buffer_Data(pbo, row_size * rect->h, nullptr, GL_STREAM_DRAW);
+    uint8_t *dst = GFX_GL_Buffer_Map(pbo, GL_WRITE_ONLY);
+    if (dst != nullptr) {
+        for (int32_t y = 0; y < rect->h; y++) {
+            memcpy(dst, src, row_size);
+            dst += row_size;
+            src += src_stride;
+        }
+        GFX_GL_Buffer_Unmap(pbo);
+        glTexSubImage2D(
+            GL_TEXTURE_2D, 0, rect->x, rect->y, rect->w, rect->h,
+            desc->tex_format, desc->tex_type, nullptr);
+        GFX_GL_CheckError();
+        glBindBuffer(GL_PIXEL_UNPACK_BUFFER, 0);
+        return;
+    }
+
+    // Mapping failed, fall back to a plain client memory upload.
+    glBindBuffer(GL_PIXEL_UNPACK_BUFFER, 0);
+    glPixelStorei(GL_UNPACK_ROW_LENGTH, desc->width);
+    glTexSubImage2D(
+        GL_TEXTURE_2D, 0, rect->x, rect->y, rect->w, rect->h, desc->tex_format,
+        desc->tex_type, src);
+    GFX_GL_CheckError();
+    glPixelStorei(GL_UNPACK_ROW_LENGTH, 0);
+}
+
+// Updates the currently bound texture. Full uploads are skipped if the data
+// is identical to the previous one, partial ones only touch the given rect.
+static void M_UploadTexture(
+    GFX_2D_RENDERER *const r, const GFX_2D_SURFACE_DESC *const old_desc,
+    M_CONTENT_HASH *const hash, const GFX_2D_SURFACE_DESC *const desc,
+    const uint8_t *const data, const GFX_2D_RECT *const dirty_rect)
+{
+    glPixelStorei(GL_PACK_ALIGNMENT, 1);
+    GFX_GL_CheckError();
+    glPixelStorei(GL_UNPACK_ALIGNMENT, 1);
+    GFX_GL_CheckError();
+
+    // update buffer if the size is unchanged, otherwise create a new one
+    if (old_desc->width != desc->width || old_desc->height != desc->height
+        || old_desc->tex_format != desc->tex_format
+        || old_desc->tex_type != desc->tex_type) {
+        glTexImage2D(
+            GL_TEXTURE_2D, 0, GL_RGBA, desc->width, desc->height, 0,
+            desc->tex_format, desc->tex_type, data);
+        GFX_GL_CheckError();
+        hash->is_valid = false;
+        return;
+    }
+
+    GFX_2D_RECT rect = {
+        .x = 0,
+        .y = 0,
+        .w = desc->width,
+        .h = desc->height,
+    };
+    if (dirty_rect != nullptr) {
+        hash->is_valid = false;
+        rect = *dirty_rect;
+        CLAMP(rect.x, 0, desc->width);
+        CLAMP(rect.y, 0, desc->height);
+        CLAMP(rect.w, 0, desc->width - rect.x);
+        CLAMP(rect.h, 0, desc->height - rect.y);
+        if (rect.w == 0 || rect.h == 0) {
+            return;
+        }
+    } else {
+        const uint64_t value = M_HashData(
+            data, (size_t)desc->width * desc->height * (desc->bit_count / 8));
+        if (hash->is_valid && hash->value == value) {
+            return;
+        }
+        hash->is_valid = true;
+        hash->value = value;
+    }
+
+    M_UploadRect(r, desc, data, &rect);
+}
+
 GFX_2D_RENDERER *GFX_2D_Renderer_Create(void)
 {
     LOG_INFO("");
@@ -138,6 +262,11 @@ GFX_2D_RENDERER *GFX_2D_Renderer_Create(void)
     GFX_GL_Texture_Init(&r->palette_texture, GL_TEXTURE_1D);
     GFX_GL_Texture_Init(&r->alpha_texture, GL_TEXTURE_2D);
 
+    for (int32_t i = 0; i < M_PBO_COUNT; i++) {
+        GFX_GL_Buffer_Init(&r->pbo[i], GL_PIXEL_UNPACK_BUFFER);
+    }
+    r->pbo_idx = 0;
+
     GFX_GL_Program_Init(&r->program);
     GFX_GL_Program_AttachShader(
         &r->program, GL_VERTEX_SHADER, "shaders/2d.glsl", config->backend);
@@ -193,19 +322,24 @@ void GFX_2D_Renderer_Destroy(GFX_2D_RENDERER *const r)
     GFX_GL_Texture_Close(&r->surface_texture);
     GFX_GL_Texture_Close(&r->palette_texture);
     GFX_GL_Texture_Close(&r->alpha_texture);
+    for (int32_t i = 0; i < M_PBO_COUNT; i++) {
+        GFX_GL_Buffer_Close(&r->pbo[i]);
+    }
     GFX_GL_Program_Close(&r->program);
     Memory_FreePointer(&r->vertices);
     Memory_Free(r);
 }
 
 void GFX_2D_Renderer_UploadSurface(
-    GFX_2D_RENDERER *const r, GFX_2D_SURFACE *const surface)
+    GFX_2D_RENDERER *const r, GFX_2D_SURFACE *const surface,
+    const GFX_2D_RECT *const dirty_rect)
 {
-    GFX_2D_Renderer_Upload(r, &surface->desc, surface->buffer);
+    GFX_2D_Renderer_Upload(r, &surface->desc, surface->buffer, dirty_rect);
 }
 
 void GFX_2D_Renderer_UploadAlphaSurface(
-    GFX_2D_RENDERER *const r, GFX_2D_SURFACE *const surface)
+    GFX_2D_RENDERER *const r, GFX_2D_SURFACE *const surface,
+    const GFX_2D_RECT *const dirty_rect)
 {
     ASSERT(r != nullptr);
 
@@ -229,31 +363,9 @@ void GFX_2D_Renderer_UploadAlphaSurface(
 
     glActiveTexture(GL_TEXTURE2);
     GFX_GL_Texture_Bind(&r->alpha_texture);
-
-    // update buffer if the size is unchanged, otherwise create a new one
-    if (r->alpha_desc.width != surface->desc.width
-        || r->alpha_desc.height != surface->desc.height
-        || r->alpha_desc.tex_format != surface->desc.tex_format
-        || r->alpha_desc.tex_type != surface->desc.tex_type) {
-        glPixelStorei(GL_PACK_ALIGNMENT, 1);
-        GFX_GL_CheckError();
-        glPixelStorei(GL_UNPACK_ALIGNMENT, 1);
-        GFX_GL_CheckError();
-        glTexImage2D(
-            GL_TEXTURE_2D, 0, GL_RGBA, surface->desc.width,
-            surface->desc.height, 0, surface->desc.tex_format,
-            surface->desc.tex_type, surface->buffer);
-        GFX_GL_CheckError();
-    } else {
-        glPixelStorei(GL_PACK_ALIGNMENT, 1);
-        GFX_GL_CheckError();
-        glPixelStorei(GL_UNPACK_ALIGNMENT, 1);
-        GFX_GL_CheckError();
-        glTexSubImage2D(
-            GL_TEXTURE_2D, 0, 0, 0, surface->desc.width, surface->desc.height,
-            surface->desc.tex_format, surface->desc.tex_type, surface->buffer);
-        GFX_GL_CheckError();
-    }
+    M_UploadTexture(
+        r, &r->alpha_desc, &r->alpha_hash, &surface->desc, surface->buffer,
+        dirty_rect);
     glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
     glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
     glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_NEAREST);
@@ -265,7 +377,7 @@ void GFX_2D_Renderer_UploadAlphaSurface(
 
 void GFX_2D_Renderer_Upload(
     GFX_2D_RENDERER *const r, GFX_2D_SURFACE_DESC *const desc,
-    const uint8_t *const data)
+    const uint8_t *const data, const GFX_2D_RECT *const dirty_rect)
 {
     ASSERT(r != nullptr);
 
@@ -277,28 +389,7 @@ void GFX_2D_Renderer_Upload(
     glActiveTexture(GL_TEXTURE0);
     GFX_GL_Texture_Bind(&r->surface_texture);
 
-    // update buffer if the size is unchanged, otherwise create a new one
-    if (r->desc.width != desc->width || r->desc.height != desc->height
-        || r->desc.tex_format != desc->tex_format
-        || r->desc.tex_type != desc->tex_type) {
-        glPixelStorei(GL_PACK_ALIGNMENT, 1);
-        GFX_GL_CheckError();
-        glPixelStorei(GL_UNPACK_ALIGNMENT, 1);
-        GFX_GL_CheckError();
-        glTexImage2D(
-            GL_TEXTURE_2D, 0, GL_RGBA, desc->width, desc->height, 0,
-            desc->tex_format, desc->tex_type, data);
-        GFX_GL_CheckError();
-    } else {
-        glPixelStorei(GL_PACK_ALIGNMENT, 1);
-        GFX_GL_CheckError();
-        glPixelStorei(GL_UNPACK_ALIGNMENT, 1);
-        GFX_GL_CheckError();
-        glTexSubImage2D(
-            GL_TEXTURE_2D, 0, 0, 0, desc->width, desc->height, desc->tex_format,
-            desc->tex_type, data);
-        GFX_GL_CheckError();
-    }
+    M_UploadTexture(r, &r->desc, &r->hash, desc, data, dirty_rect);
 
     r->desc = *desc;
     if (reupload_vert) {
@@ -5,6 +5,13 @@
 #include "gfx/gl/utils.h"
 #include "log.h"
 #include "memory.h"
+#include "utils.h"
+
+// Units 1 and 2 belong to the 2D renderer.
+#define PAGE_TEXTURE_UNIT 3
+// The reflections are blurry enough that a small map is indistinguishable
+// from one sized like the viewport, and it is much cheaper to fill.
+#define ENV_MAP_SIZE 256
 
 struct GFX_3D_RENDERER {
     const GFX_CONFIG *config;
@@ -13,8 +20,15 @@ struct GFX_3D_RENDERER {
     GFX_GL_SAMPLER sampler;
     GFX_3D_VERTEX_STREAM vertex_stream;
 
-    GFX_GL_TEXTURE *textures[GFX_MAX_TEXTURES];
+    // Texture pages are the layers of a single array texture bound to its own
+    // unit, so that switching between them needs no flush.
+    GFX_GL_TEXTURE *page_array;
+    int page_count;
+    int page_width;
+    int page_height;
+    bool page_used[GFX_MAX_TEXTURES];
     GFX_GL_TEXTURE *env_map_texture;
+    GLuint env_map_fbo;
     int selected_texture_num;
     GFX_BLEND_MODE selected_blend_mode;
     bool alpha_point_discard;
@@ -28,12 +42,15 @@ struct GFX_3D_RENDERER {
     GLint loc_alpha_point_discard;
     GLint loc_alpha_threshold;
     GLint loc_brightness_multiplier;
+    GLint loc_tex_pages;
 };
 
 static void M_ApplyUniforms(GFX_3D_RENDERER *renderer);
 static void M_Flush(GFX_3D_RENDERER *renderer);
+static void M_FreePages(GFX_3D_RENDERER *renderer);
 static void M_SelectTextureImpl(GFX_3D_RENDERER *renderer, int texture_num);
 static void M_RestoreTexture(GFX_3D_RENDERER *const renderer);
+static void M_BlitEnvironmentMap(GFX_3D_RENDERER *renderer);
 
 static void M_ApplyUniforms(GFX_3D_RENDERER *const renderer)
 {
@@ -79,27 +96,45 @@ static void M_Flush(GFX_3D_RENDERER *const renderer)
     M_ApplyUniforms(renderer);
 }
 
+static void M_FreePages(GFX_3D_RENDERER *const renderer)
+{
+    GFX_GL_Texture_Free(renderer->page_array);
+    renderer->page_array = nullptr;
+    renderer->page_count = 0;
+    for (int i = 0; i < GFX_MAX_TEXTURES; i++) {
+        renderer->page_used[i] = false;
+    }
+}
+
 static void M_SelectTextureImpl(
     GFX_3D_RENDERER *const renderer, const int texture_num)
 {
     ASSERT(renderer != nullptr);
 
-    GFX_GL_TEXTURE *texture = nullptr;
-    if (texture_num == GFX_ENV_MAP_TEXTURE) {
-        texture = renderer->env_map_texture;
-    } else if (texture_num != GFX_NO_TEXTURE) {
-        ASSERT(texture_num >= 0);
+    glActiveTexture(GL_TEXTURE0 + PAGE_TEXTURE_UNIT);
+    GFX_GL_CheckError();
+    if (renderer->page_array != nullptr) {
+        GFX_GL_Texture_Bind(renderer->page_array);
+    } else {
+        glBindTexture(GL_TEXTURE_2D_ARRAY, 0);
+        GFX_GL_CheckError();
+    }
+    glActiveTexture(GL_TEXTURE0);
+    GFX_GL_CheckError();
+
+    if (texture_num >= 0) {
         ASSERT(texture_num < GFX_MAX_TEXTURES);
-        texture = renderer->textures[texture_num];
+        GFX_3D_VertexStream_SetLayer(&renderer->vertex_stream, texture_num);
+    } else {
+        GFX_3D_VertexStream_SetLayer(&renderer->vertex_stream, -1.0f);
     }
 
-    if (texture == nullptr) {
+    if (texture_num == GFX_NO_TEXTURE || renderer->env_map_texture == nullptr) {
         glBindTexture(GL_TEXTURE_2D, 0);
         GFX_GL_CheckError();
-        return;
+    } else {
+        GFX_GL_Texture_Bind(renderer->env_map_texture);
     }
-
-    GFX_GL_Texture_Bind(texture);
 }
 
 static void M_RestoreTexture(GFX_3D_RENDERER *const renderer)
@@ -108,6 +143,30 @@ static void M_RestoreTexture(GFX_3D_RENDERER *const renderer)
     M_SelectTextureImpl(renderer, renderer->selected_texture_num);
 }
 
+static void M_BlitEnvironmentMap(GFX_3D_RENDERER *const renderer)
+{
+    GLint viewport[4];
+    glGetIntegerv(GL_VIEWPORT, viewport);
+    GFX_GL_CheckError();
+
+    const GLint side = MIN(viewport[2], viewport[3]);
+    const GLint x = viewport[0] + (viewport[2] - side) / 2;
+    const GLint y = viewport[1] + (viewport[3] - side) / 2;
+
+    // Read from whatever the scene is being drawn into - the FBO renderer's
+    // framebuffer or the default back buffer - and let the GPU scale the
+    // square down, without a round trip through the texture unit state.
+    GLint scene_fbo;
+    glGetIntegerv(GL_DRAW_FRAMEBUFFER_BINDING, &scene_fbo);
+    glBindFramebuffer(GL_READ_FRAMEBUFFER, scene_fbo);
+    glBindFramebuffer(GL_DRAW_FRAMEBUFFER, renderer->env_map_fbo);
+    glBlitFramebuffer(
+        x, y, x + side, y + side, 0, 0, ENV_MAP_SIZE, ENV_MAP_SIZE,
+        GL_COLOR_BUFFER_BIT, GL_LINEAR);
+    glBindFramebuffer(GL_FRAMEBUFFER, scene_fbo);
+    GFX_GL_CheckError();
+}
+
 GFX_3D_RENDERER *GFX_3D_Renderer_Create(void)
 {
     LOG_INFO("");
@@ -115,14 +174,13 @@ GFX_3D_RENDERER *GFX_3D_Renderer_Create(void)
     renderer->config = GFX_Context_GetConfig();
 
     renderer->selected_texture_num = GFX_NO_TEXTURE;
-    for (int i = 0; i < GFX_MAX_TEXTURES; i++) {
-        renderer->textures[i] = nullptr;
-    }
+    M_FreePages(renderer);
     renderer->alpha_point_discard = false;
     renderer->alpha_threshold = -1.0;
 
     GFX_GL_Sampler_Init(&renderer->sampler);
     GFX_GL_Sampler_Bind(&renderer->sampler, 0);
+    GFX_GL_Sampler_Bind(&renderer->sampler, PAGE_TEXTURE_UNIT);
     GFX_GL_Sampler_Parameterf(
         &renderer->sampler, GL_TEXTURE_MAX_ANISOTROPY_EXT, 1);
     GFX_GL_Sampler_Parameteri(
@@ -154,8 +212,12 @@ GFX_3D_RENDERER *GFX_3D_Renderer_Create(void)
         GFX_GL_Program_UniformLocation(&renderer->program, "alphaThreshold");
     renderer->loc_brightness_multiplier = GFX_GL_Program_UniformLocation(
         &renderer->program, "brightnessMultiplier");
+    renderer->loc_tex_pages =
+        GFX_GL_Program_UniformLocation(&renderer->program, "texPages");
 
     GFX_GL_Program_Bind(&renderer->program);
+    GFX_GL_Program_Uniform1i(
+        &renderer->program, renderer->loc_tex_pages, PAGE_TEXTURE_UNIT);
 
     GLfloat model_view[4][4] = {
         { +1.0f, +0.0f, +0.0f, +0.0f },
@@ -179,6 +241,7 @@ void GFX_3D_Renderer_Destroy(GFX_3D_RENDERER *const renderer)
     LOG_INFO("");
     ASSERT(renderer != nullptr);
 
+    M_FreePages(renderer);
     GFX_3D_VertexStream_Close(&renderer->vertex_stream);
     GFX_GL_Program_Close(&renderer->program);
     GFX_GL_Sampler_Close(&renderer->sampler);
@@ -190,11 +253,13 @@ void GFX_3D_Renderer_RenderBegin(GFX_3D_RENDERER *const renderer)
     ASSERT(renderer != nullptr);
 
     renderer->vertex_stream.rendered_count = 0;
+    renderer->vertex_stream.draw_count = 0;
     renderer->vertex_stream.transferred = 0;
 
     GFX_GL_Program_Bind(&renderer->program);
     GFX_3D_VertexStream_Bind(&renderer->vertex_stream);
     GFX_GL_Sampler_Bind(&renderer->sampler, 0);
+    GFX_GL_Sampler_Bind(&renderer->sampler, PAGE_TEXTURE_UNIT);
 
     M_RestoreTexture(renderer);
     M_ApplyUniforms(renderer);
@@ -248,8 +313,22 @@ int GFX_3D_Renderer_RegisterEnvironmentMap(GFX_3D_RENDERER *const renderer)
     ASSERT(renderer->env_map_texture == nullptr);
 
     GFX_GL_TEXTURE *const texture = GFX_GL_Texture_Create(GL_TEXTURE_2D);
+    GFX_GL_Texture_Load(
+        texture, nullptr, ENV_MAP_SIZE, ENV_MAP_SIZE, GL_RGB, GL_RGB);
     renderer->env_map_texture = texture;
 
+    GLint scene_fbo;
+    glGetIntegerv(GL_FRAMEBUFFER_BINDING, &scene_fbo);
+    glGenFramebuffers(1, &renderer->env_map_fbo);
+    glBindFramebuffer(GL_FRAMEBUFFER, renderer->env_map_fbo);
+    glFramebufferTexture2D(
+        GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, GL_TEXTURE_2D, texture->id, 0);
+    if (glCheckFramebufferStatus(GL_FRAMEBUFFER) != GL_FRAMEBUFFER_COMPLETE) {
+        LOG_ERROR("environment map framebuffer is not complete!");
+    }
+    glBindFramebuffer(GL_FRAMEBUFFER, scene_fbo);
+    GFX_GL_CheckError();
+
     M_RestoreTexture(renderer);
     return GFX_ENV_MAP_TEXTURE;
 }
@@ -270,14 +349,21 @@ bool GFX_3D_Renderer_UnregisterEnvironmentMap(
         return false;
     }
 
+    // The map stays bound while pages are selected, so queued vertices may
+    // still sample it.
+    M_Flush(renderer);
+
     // unbind texture if currently bound
     if (renderer->selected_texture_num == texture_num) {
         M_SelectTextureImpl(renderer, GFX_NO_TEXTURE);
         renderer->selected_texture_num = GFX_NO_TEXTURE;
     }
 
+    glDeleteFramebuffers(1, &renderer->env_map_fbo);
+    renderer->env_map_fbo = 0;
     GFX_GL_Texture_Free(texture);
     renderer->env_map_texture = nullptr;
+    M_RestoreTexture(renderer);
     return true;
 }
 
@@ -285,12 +371,50 @@ void GFX_3D_Renderer_FillEnvironmentMap(GFX_3D_RENDERER *const renderer)
 {
     ASSERT(renderer != nullptr);
 
-    GFX_GL_TEXTURE *const env_map = renderer->env_map_texture;
-    if (env_map != nullptr) {
+    if (renderer->env_map_texture != nullptr) {
         M_Flush(renderer);
-        GFX_GL_Texture_LoadFromBackBuffer(env_map);
+        M_BlitEnvironmentMap(renderer);
+    }
+}
+
+void GFX_3D_Renderer_BeginTexturePages(
+    GFX_3D_RENDERER *const renderer, const int count, const int width,
+    const int height)
+{
+    ASSERT(renderer != nullptr);
+    ASSERT(count >= 0);
+    ASSERT(count <= GFX_MAX_TEXTURES);
+
+    M_Flush(renderer);
+    M_FreePages(renderer);
+    if (count == 0) {
         M_RestoreTexture(renderer);
+        return;
+    }
+
+    renderer->page_array = GFX_GL_Texture_Create(GL_TEXTURE_2D_ARRAY);
+    renderer->page_count = count;
+    renderer->page_width = width;
+    renderer->page_height = height;
+
+    glActiveTexture(GL_TEXTURE0 + PAGE_TEXTURE_UNIT);
+    GFX_GL_CheckError();
+    GFX_GL_Texture_AllocateLayers(renderer->page_array, width, height, count);
+    glActiveTexture(GL_TEXTURE0);
+    GFX_GL_CheckError();
+}
+
+void GFX_3D_Renderer_EndTexturePages(GFX_3D_RENDERER *const renderer)
+{
+    ASSERT(renderer != nullptr);
+    if (renderer->page_array != nullptr) {
+        glActiveTexture(GL_TEXTURE0 + PAGE_TEXTURE_UNIT);
+        GFX_GL_CheckError();
+        GFX_GL_Texture_GenerateMipmaps(renderer->page_array);
+        glActiveTexture(GL_TEXTURE0);
+        GFX_GL_CheckError();
     }
+    M_RestoreTexture(renderer);
 }
 
 int GFX_3D_Renderer_RegisterTexturePage(
@@ -299,20 +423,37 @@ int GFX_3D_Renderer_RegisterTexturePage(
 {
     ASSERT(renderer != nullptr);
     ASSERT(data != nullptr);
-    GFX_GL_TEXTURE *const texture = GFX_GL_Texture_Create(GL_TEXTURE_2D);
-    GFX_GL_Texture_Load(texture, data, width, height, GL_RGBA, GL_RGBA);
+
+    if (renderer->page_array == nullptr) {
+        LOG_ERROR("No texture page storage allocated");
+        return GFX_NO_TEXTURE;
+    }
+    if (width != renderer->page_width || height != renderer->page_height) {
+        LOG_ERROR("Invalid texture page size: %dx%d", width, height);
+        return GFX_NO_TEXTURE;
+    }
 
     int texture_num = GFX_NO_TEXTURE;
-    for (int i = 0; i < GFX_MAX_TEXTURES; i++) {
-        if (!renderer->textures[i]) {
-            renderer->textures[i] = texture;
+    for (int i = 0; i < renderer->page_count; i++) {
+        if (!renderer->page_used[i]) {
+            renderer->page_used[i] = true;
             texture_num = i;
             break;
         }
     }
+    if (texture_num == GFX_NO_TEXTURE) {
+        LOG_ERROR("Texture page storage is full");
+        return GFX_NO_TEXTURE;
+    }
 
-    M_RestoreTexture(renderer);
+    glActiveTexture(GL_TEXTURE0 + PAGE_TEXTURE_UNIT);
+    GFX_GL_CheckError();
+    GFX_GL_Texture_LoadLayer(
+        renderer->page_array, texture_num, data, width, height, GL_RGBA);
+    glActiveTexture(GL_TEXTURE0);
+    GFX_GL_CheckError();
 
+    M_RestoreTexture(renderer);
     return texture_num;
 }
 
@@ -323,20 +464,19 @@ bool GFX_3D_Renderer_UnregisterTexturePage(
     ASSERT(texture_num >= 0);
     ASSERT(texture_num < GFX_MAX_TEXTURES);
 
-    GFX_GL_TEXTURE *const texture = renderer->textures[texture_num];
-    if (!texture) {
+    if (!renderer->page_used[texture_num]) {
         LOG_ERROR("Invalid texture handle");
         return false;
     }
 
     // unbind texture if currently bound
     if (texture_num == renderer->selected_texture_num) {
+        M_Flush(renderer);
         M_SelectTextureImpl(renderer, GFX_NO_TEXTURE);
         renderer->selected_texture_num = GFX_NO_TEXTURE;
     }
 
-    GFX_GL_Texture_Free(texture);
-    renderer->textures[texture_num] = nullptr;
+    renderer->page_used[texture_num] = false;
     return true;
 }
 
@@ -372,7 +512,16 @@ void GFX_3D_Renderer_SelectTexture(
     GFX_3D_RENDERER *const renderer, int texture_num)
 {
     ASSERT(renderer != nullptr);
-    M_Flush(renderer);
+
+    // Pages and the environment map are all bound at once and told apart by
+    // the vertex layer. Only dropping or restoring the texture binding
+    // affects vertices that are already queued.
+    const bool was_unbound =
+        renderer->selected_texture_num == GFX_NO_TEXTURE;
+    const bool is_unbound = texture_num == GFX_NO_TEXTURE;
+    if (was_unbound != is_unbound) {
+        M_Flush(renderer);
+    }
     renderer->selected_texture_num = texture_num;
     M_SelectTextureImpl(renderer, texture_num);
 }
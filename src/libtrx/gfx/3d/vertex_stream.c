@@ -28,16 +28,21 @@ static void M_PushVertex(
             vertex_stream->pending_vertices.capacity * sizeof(GFX_3D_VERTEX));
     }
 
-    vertex_stream->pending_vertices
-        .data[vertex_stream->pending_vertices.count++] = *vertex;
+    GFX_3D_VERTEX *const target =
+        &vertex_stream->pending_vertices
+             .data[vertex_stream->pending_vertices.count++];
+    *target = *vertex;
+    target->layer = vertex_stream->layer;
 }
 
 void GFX_3D_VertexStream_Init(GFX_3D_VERTEX_STREAM *const vertex_stream)
 {
     vertex_stream->prim_type = GFX_3D_PRIM_TRI;
+    vertex_stream->layer = -1.0f;
     vertex_stream->buffer_size =
         M_PREALLOC_VERTEX_COUNT * sizeof(GFX_3D_VERTEX);
     vertex_stream->rendered_count = 0;
+    vertex_stream->draw_count = 0;
     vertex_stream->transferred = 0;
     vertex_stream->pending_vertices.count = 0;
     vertex_stream->pending_vertices.capacity = M_PREALLOC_VERTEX_COUNT;
@@ -61,6 +66,9 @@ void GFX_3D_VertexStream_Init(GFX_3D_VERTEX_STREAM *const vertex_stream)
     GFX_GL_VertexArray_Attribute(
         &vertex_stream->vtc_format, 2, 4, GL_FLOAT, GL_FALSE,
         sizeof(GFX_3D_VERTEX), offsetof(GFX_3D_VERTEX, r));
+    GFX_GL_VertexArray_Attribute(
+        &vertex_stream->vtc_format, 3, 1, GL_FLOAT, GL_FALSE,
+        sizeof(GFX_3D_VERTEX), offsetof(GFX_3D_VERTEX, layer));
 
     GFX_GL_CheckError();
 }
@@ -83,6 +91,12 @@ void GFX_3D_VertexStream_SetPrimType(
     vertex_stream->prim_type = prim_type;
 }
 
+void GFX_3D_VertexStream_SetLayer(
+    GFX_3D_VERTEX_STREAM *const vertex_stream, const float layer)
+{
+    vertex_stream->layer = layer;
+}
+
 bool GFX_3D_VertexStream_PushPrimStrip(
     GFX_3D_VERTEX_STREAM *const vertex_stream,
     const GFX_3D_VERTEX *const vertices, const int count)
@@ -177,5 +191,6 @@ void GFX_3D_VertexStream_RenderPending(
     GFX_GL_CheckError();
 
     vertex_stream->rendered_count += vertex_stream->pending_vertices.count;
+    vertex_stream->draw_count++;
     vertex_stream->pending_vertices.count = 0;
 }
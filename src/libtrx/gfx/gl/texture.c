@@ -67,28 +67,59 @@ void GFX_GL_Texture_Load(
     GFX_GL_CheckError();
 }
 
-void GFX_GL_Texture_LoadFromBackBuffer(GFX_GL_TEXTURE *const texture)
+void GFX_GL_Texture_AllocateLayers(
+    GFX_GL_TEXTURE *const texture, const int width, const int height,
+    const int layer_count)
 {
     ASSERT(texture != nullptr);
     ASSERT(texture->initialized);
+    ASSERT(texture->target == GL_TEXTURE_2D_ARRAY);
 
     GFX_GL_Texture_Bind(texture);
 
-    GLint viewport[4];
-    glGetIntegerv(GL_VIEWPORT, viewport);
-    GFX_GL_CheckError();
+    int levels = 1;
+    while ((MAX(width, height) >> levels) > 0) {
+        levels++;
+    }
 
-    const GLint vp_x = viewport[0];
-    const GLint vp_y = viewport[1];
-    const GLint vp_w = viewport[2];
-    const GLint vp_h = viewport[3];
+    if (GLEW_ARB_texture_storage) {
+        glTexStorage3D(
+            GL_TEXTURE_2D_ARRAY, levels, GL_RGBA8, width, height, layer_count);
+        GFX_GL_CheckError();
+    } else {
+        for (int level = 0; level < levels; level++) {
+            glTexImage3D(
+                GL_TEXTURE_2D_ARRAY, level, GL_RGBA8, MAX(width >> level, 1),
+                MAX(height >> level, 1), layer_count, 0, GL_RGBA,
+                GL_UNSIGNED_BYTE, nullptr);
+            GFX_GL_CheckError();
+        }
+        glTexParameteri(GL_TEXTURE_2D_ARRAY, GL_TEXTURE_MAX_LEVEL, levels - 1);
+        GFX_GL_CheckError();
+    }
+}
 
-    const int32_t side = MIN(vp_w, vp_h);
-    const int32_t x = vp_x + (vp_w - side) / 2;
-    const int32_t y = vp_y + (vp_h - side) / 2;
-    const int32_t w = side;
-    const int32_t h = side;
+void GFX_GL_Texture_LoadLayer(
+    GFX_GL_TEXTURE *const texture, const int layer, const void *const data,
+    const int width, const int height, const GLint format)
+{
+    ASSERT(texture != nullptr);
+    ASSERT(texture->initialized);
+    ASSERT(texture->target == GL_TEXTURE_2D_ARRAY);
 
-    glCopyTexImage2D(GL_TEXTURE_2D, 0, GL_RGB, x, y, w, h, 0);
+    GFX_GL_Texture_Bind(texture);
+    glTexSubImage3D(
+        GL_TEXTURE_2D_ARRAY, 0, 0, 0, layer, width, height, 1, format,
+        GL_UNSIGNED_BYTE, data);
+    GFX_GL_CheckError();
+}
+
+void GFX_GL_Texture_GenerateMipmaps(GFX_GL_TEXTURE *const texture)
+{
+    ASSERT(texture != nullptr);
+    ASSERT(texture->initialized);
+
+    GFX_GL_Texture_Bind(texture);
+    glGenerateMipmap(texture->target);
     GFX_GL_CheckError();
 }
@@ -1,6 +1,7 @@
 #pragma once
 
 #include <SDL2/SDL_stdinc.h>
+#include <stddef.h>
 
 typedef struct {
     Uint64 start;
@@ -9,6 +10,10 @@ typedef struct {
 
 BENCHMARK *Benchmark_Start(void);
 
+// Returns the peak resident set size of the process in bytes, or 0 if the
+// platform does not report it.
+size_t Benchmark_GetPeakRSS(void);
+
 #define Benchmark_End(b, ...)                                                  \
     Benchmark_End_Impl(b, __FILE__, __LINE__, __func__, __VA_ARGS__)
 
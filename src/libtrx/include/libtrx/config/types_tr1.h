@@ -12,6 +12,8 @@
 #define CONFIG_MAX_TEXT_SCALE 2.0
 #define CONFIG_MIN_BAR_SCALE 0.5
 #define CONFIG_MAX_BAR_SCALE 1.5
+#define CONFIG_MIN_FPS 30
+#define CONFIG_MAX_FPS 240
 
 typedef enum {
     BSM_DEFAULT,
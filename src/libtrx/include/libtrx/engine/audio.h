@@ -15,6 +15,13 @@ bool Audio_Shutdown(void);
 bool Audio_Stream_Pause(int32_t sound_id);
 bool Audio_Stream_Unpause(int32_t sound_id);
 int32_t Audio_Stream_CreateFromFile(const char *path);
+// Returns a sound id right away and opens the file on a worker thread. The
+// stream starts playing once it is ready, unless it was created paused or got
+// paused in the meantime. Closing or seeking the stream waits for the load to
+// finish. If the load fails, the stream is closed once it has a finish
+// callback; until then the owner has to check for the failure and close it.
+int32_t Audio_Stream_CreateFromFileAsync(const char *path, bool is_paused);
+bool Audio_Stream_IsLoadFailed(int32_t sound_id);
 bool Audio_Stream_Close(int32_t sound_id);
 bool Audio_Stream_IsLooped(int32_t sound_id);
 bool Audio_Stream_SetVolume(int32_t sound_id, float volume);
@@ -17,6 +17,17 @@ typedef enum {
 
 typedef struct MYFILE MYFILE;
 
+typedef struct {
+    char *name;
+    size_t size;
+    int64_t mtime;
+} FILE_ENTRY;
+
+typedef struct {
+    int32_t count;
+    FILE_ENTRY *entries;
+} FILE_LISTING;
+
 bool File_DirExists(const char *path);
 
 bool File_IsAbsolute(const char *path);
@@ -39,6 +50,9 @@ char *File_GuessExtension(const char *path, const char **extensions);
 
 MYFILE *File_Open(const char *path, FILE_OPEN_MODE mode);
 
+// Opens a file that lives in memory only and grows as it is written to.
+MYFILE *File_OpenMemory(void);
+
 void File_ReadData(MYFILE *file, void *data, size_t size);
 void File_ReadItems(MYFILE *file, void *data, size_t count, size_t item_size);
 int8_t File_ReadS8(MYFILE *file);
@@ -58,6 +72,10 @@ void File_WriteU8(MYFILE *file, uint8_t value);
 void File_WriteU16(MYFILE *file, uint16_t value);
 void File_WriteU32(MYFILE *file, uint32_t value);
 
+// Set once a read runs past the end of the file, or a write or seek fails.
+// Short reads fill the rest of the destination with zeros.
+bool File_HasError(MYFILE *file);
+
 size_t File_Pos(MYFILE *file);
 
 size_t File_Size(MYFILE *file);
@@ -70,6 +88,23 @@ void File_Seek(MYFILE *file, size_t pos, FILE_SEEK_MODE mode);
 
 void File_Close(MYFILE *file);
 
+// Closes a memory file and hands its contents over to the caller, who is then
+// responsible for releasing them with Memory_Free.
+void File_CloseMemory(MYFILE *file, char **out_data, size_t *out_size);
+
+// Writes the data to a temporary file next to the target, flushes it to the
+// disk and only then renames it over the target, so that a crash at any point
+// leaves either the old or the new file intact.
+bool File_WriteAtomic(const char *path, const void *data, size_t size);
+
 bool File_Load(const char *path, char **output_data, size_t *output_size);
 
 void File_CreateDirectory(const char *path);
+
+// Lists the regular files in a directory together with their sizes and
+// modification times. Returns nullptr if the directory cannot be read.
+FILE_LISTING *File_ListDirectory(const char *path);
+void File_FreeListing(FILE_LISTING *listing);
+
+// Finds a file by name, ignoring case like File_Open does.
+const FILE_ENTRY *File_FindEntry(const FILE_LISTING *listing, const char *name);
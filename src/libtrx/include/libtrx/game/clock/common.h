@@ -3,11 +3,28 @@
 #include <stddef.h>
 #include <stdint.h>
 
+#define CLOCK_JITTER_BUCKET_COUNT 8
+
+// How late Clock_WaitTick woke up past each frame deadline. The buckets
+// cover <50, <100, <250, <500, <1000, <2000, <4000 and >=4000 microseconds.
+typedef struct {
+    int32_t frames;
+    double total_us;
+    double max_us;
+    int32_t buckets[CLOCK_JITTER_BUCKET_COUNT];
+} CLOCK_JITTER_STATS;
+
 void Clock_Init(void);
 
 void Clock_SyncTick(void);
 int32_t Clock_WaitTick(void);
 
+// Collected since startup or the last reset. Reported by the /pacing console
+// command, which writes the histogram to the log and starts over.
+const CLOCK_JITTER_STATS *Clock_GetJitterStats(void);
+void Clock_ResetJitterStats(void);
+void Clock_DumpJitterStats(void);
+
 size_t Clock_GetDateTime(char *buffer, size_t size);
 
 int32_t Clock_GetFrameAdvance(void);
@@ -9,6 +9,11 @@
 // allocations. This design offers very fast allocation speeds, but individual
 // blocks cannot be freed – only the entire arena can be reset when needed. For
 // more granular memory management, use Memory_Alloc / Memory_Free.
+//
+// Every allocation is accounted for under its GAME_BUFFER tag. Building with
+// GAME_BUF_DEBUG instead gives each tag its own arena, whose pages past the
+// newest allocation stay inaccessible, to catch buffer overruns as they
+// happen.
 
 typedef enum {
     // clang-format off
@@ -52,8 +57,20 @@ typedef enum {
     // clang-format on
 } GAME_BUFFER;
 
+typedef struct {
+    size_t bytes;
+    size_t allocs;
+    // High-water mark of bytes; survives GameBuf_Reset.
+    size_t peak_bytes;
+} GAME_BUF_STATS;
+
 void GameBuf_Init(void);
 void GameBuf_Shutdown(void);
 void GameBuf_Reset(void);
 
 void *GameBuf_Alloc(size_t alloc_size, GAME_BUFFER buffer);
+
+const GAME_BUF_STATS *GameBuf_GetStats(GAME_BUFFER buffer);
+size_t GameBuf_GetTotalBytes(void);
+size_t GameBuf_GetTotalPeakBytes(void);
+void GameBuf_DumpStats(void);
@@ -0,0 +1,34 @@
+#pragma once
+
+// Per-room spatial index of items, bucketed by sector. It mirrors the room
+// item lists so that proximity queries only need to visit the sectors around
+// a point rather than every item in the room.
+
+#include <stdint.h>
+
+// Forgets the previous level's grid. The grid itself is built lazily on the
+// first query, once rooms and items have been fully set up.
+void ItemGrid_Init(void);
+
+// Forces a full rebuild on the next query, e.g. after the room geometry
+// changed due to a flipmap.
+void ItemGrid_Invalidate(void);
+
+// Re-buckets every item whose position drifted into another sector without
+// going through Item_Animate. Meant to be called once per logic frame.
+void ItemGrid_Sync(void);
+
+// Must be called right after an item was pushed to the head of its room's
+// item list, or right before it gets unlinked from it.
+void ItemGrid_Link(int16_t item_num);
+void ItemGrid_Unlink(int16_t item_num);
+
+// Moves the item to another cell if its position crossed a sector boundary.
+void ItemGrid_Update(int16_t item_num);
+
+// Returns every item in the given room that may lie within the radius of the
+// given point on the XZ plane, in room item list order. The caller still has
+// to do the exact distance test. The list is terminated with NO_ITEM and is
+// valid until the end of the current frame.
+const int16_t *ItemGrid_GetNearbyItems(
+    int16_t room_num, int32_t x, int32_t z, int32_t radius);
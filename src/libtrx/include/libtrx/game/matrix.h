@@ -20,9 +20,30 @@ typedef struct {
     int32_t _23;
 } MATRIX;
 
-extern MATRIX *g_MatrixPtr;
+#define MAX_MATRICES 40
+#define MAX_NESTED_MATRICES 32
+
+// A self-contained matrix stack, along with the parallel stack used for
+// interpolating between two animation frames. Mesh transforms can be done on
+// any stack via the MatrixStack_* functions; the Matrix_* functions operate on
+// the default stack shared by the whole renderer.
+typedef struct {
+    MATRIX *ptr;
+    MATRIX items[MAX_MATRICES];
+    struct {
+        int32_t frac;
+        int32_t rate;
+        MATRIX *ptr;
+        MATRIX items[MAX_NESTED_MATRICES];
+    } interpolation;
+} MATRIX_STACK;
+
+extern MATRIX_STACK g_MatrixStack;
 extern MATRIX g_W2VMatrix;
 
+// The top of the default stack.
+#define g_MatrixPtr (g_MatrixStack.ptr)
+
 void Matrix_ResetStack(void);
 void Matrix_GenerateW2V(const XYZ_32 *pos, const XYZ_16 *rot);
 
@@ -67,3 +88,54 @@ void Matrix_InterpolateArm(void);
 void Matrix_LookAt(
     int32_t xsrc, int32_t ysrc, int32_t zsrc, int32_t xtar, int32_t ytar,
     int32_t ztar, int16_t roll);
+
+void MatrixStack_Reset(MATRIX_STACK *stack, const MATRIX *base);
+
+bool MatrixStack_Push(MATRIX_STACK *stack);
+bool MatrixStack_PushUnit(MATRIX_STACK *stack);
+void MatrixStack_Pop(MATRIX_STACK *stack);
+
+void MatrixStack_RotX(MATRIX_STACK *stack, int16_t rx);
+void MatrixStack_RotY(MATRIX_STACK *stack, int16_t ry);
+void MatrixStack_RotZ(MATRIX_STACK *stack, int16_t rz);
+void MatrixStack_RotYXZ(
+    MATRIX_STACK *stack, int16_t ry, int16_t rx, int16_t rz);
+void MatrixStack_Rot16(MATRIX_STACK *stack, XYZ_16 rotation);
+
+void MatrixStack_TranslateRel(
+    MATRIX_STACK *stack, int32_t x, int32_t y, int32_t z);
+void MatrixStack_TranslateRel16(MATRIX_STACK *stack, XYZ_16 offset);
+void MatrixStack_TranslateRel32(MATRIX_STACK *stack, XYZ_32 offset);
+void MatrixStack_TranslateAbs(
+    MATRIX_STACK *stack, int32_t x, int32_t y, int32_t z);
+void MatrixStack_TranslateAbs16(MATRIX_STACK *stack, XYZ_16 offset);
+void MatrixStack_TranslateAbs32(MATRIX_STACK *stack, XYZ_32 offset);
+void MatrixStack_TranslateSet(
+    MATRIX_STACK *stack, int32_t x, int32_t y, int32_t z);
+
+void MatrixStack_Push_I(MATRIX_STACK *stack);
+void MatrixStack_Pop_I(MATRIX_STACK *stack);
+
+void MatrixStack_RotY_I(MATRIX_STACK *stack, int16_t ang);
+void MatrixStack_RotX_I(MATRIX_STACK *stack, int16_t ang);
+void MatrixStack_RotZ_I(MATRIX_STACK *stack, int16_t ang);
+void MatrixStack_Rot16_I(MATRIX_STACK *stack, XYZ_16 rotation);
+void MatrixStack_Rot16_ID(
+    MATRIX_STACK *stack, XYZ_16 rotation_1, XYZ_16 rotation_2);
+
+void MatrixStack_TranslateRel_I(
+    MATRIX_STACK *stack, int32_t x, int32_t y, int32_t z);
+void MatrixStack_TranslateRel16_I(MATRIX_STACK *stack, XYZ_16 offset);
+void MatrixStack_TranslateRel32_I(MATRIX_STACK *stack, XYZ_32 offset);
+void MatrixStack_TranslateRel_ID(
+    MATRIX_STACK *stack, int32_t x, int32_t y, int32_t z, int32_t x2,
+    int32_t y2, int32_t z2);
+void MatrixStack_TranslateRel16_ID(
+    MATRIX_STACK *stack, XYZ_16 offset_1, XYZ_16 offset_2);
+void MatrixStack_TranslateRel32_ID(
+    MATRIX_STACK *stack, XYZ_32 offset_1, XYZ_32 offset_2);
+
+void MatrixStack_InitInterpolate(
+    MATRIX_STACK *stack, int32_t frac, int32_t rate);
+void MatrixStack_Interpolate(MATRIX_STACK *stack);
+void MatrixStack_InterpolateArm(MATRIX_STACK *stack);
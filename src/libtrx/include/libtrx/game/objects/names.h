@@ -8,6 +8,8 @@ const char *Object_GetName(GAME_OBJECT_ID obj_id);
 const char *Object_GetDescription(GAME_OBJECT_ID obj_id);
 
 void Object_ResetNames(void);
+// Frees the names and the search index built over them.
+void Object_ShutdownNames(void);
 
 void Object_SetName(GAME_OBJECT_ID obj_id, const char *name);
 void Object_SetDescription(GAME_OBJECT_ID obj_id, const char *description);
@@ -10,3 +10,7 @@ int16_t Box_GetOverlap(int32_t overlap_idx);
 int16_t *Box_GetFlyZone(bool flip_status);
 int16_t *Box_GetGroundZone(bool flip_status, int32_t zone_idx);
 int16_t *Box_GetLotZone(const LOT_INFO *lot);
+
+// Fills lot->node with every box that shares a zone with the given box in
+// either flip state, in ascending box order, and sets lot->zone_count.
+void Box_FillZone(LOT_INFO *lot, int16_t box_num);
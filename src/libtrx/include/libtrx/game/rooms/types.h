@@ -53,6 +53,9 @@ typedef struct {
     struct {
         int16_t height;
         int16_t tilt;
+        // Set when an item triggered from this sector can alter the height,
+        // e.g. bridges and trapdoors.
+        bool is_dynamic;
     } floor, ceiling;
 } SECTOR;
 
@@ -1,5 +1,6 @@
 #pragma once
 
+#include <stddef.h>
 #include <stdint.h>
 
 typedef enum {
@@ -8,6 +9,10 @@ typedef enum {
     SAVEGAME_STAGE_BEFORE_SAVE,
 } SAVEGAME_STAGE;
 
+// Finishes serialized savegame data on the writer thread, e.g. by compressing
+// it. May replace the buffer, which must remain freeable with Memory_Free.
+typedef bool (*SAVEGAME_ENCODE_FUNC)(char **data, size_t *size);
+
 // Remembers the slot used when the player starts a loaded game.
 // Persists across level reloads.
 void Savegame_BindSlot(int32_t slot_num);
@@ -19,6 +24,29 @@ void Savegame_UnbindSlot(void);
 // Returns the currently bound slot number. If there is none, returns -1.
 int32_t Savegame_GetBoundSlot(void);
 
+// Takes over the serialized data and writes it to the given path on a
+// background thread, passing it through the encode function first if one is
+// given. The file is replaced atomically, so the previous save survives if
+// the game dies midway. A save to a slot that is still being written waits
+// for the previous write to finish first.
+void Savegame_WriteAsync(
+    int32_t slot_num, const char *path, char *data, size_t size,
+    SAVEGAME_ENCODE_FUNC encode);
+
+// Returns true while a save to the given slot has not reached the disk yet.
+bool Savegame_IsSlotBusy(int32_t slot_num);
+
+// Blocks until the save to the given slot, if any, has been written. Must be
+// called before reading a slot back from the disk.
+void Savegame_WaitForSlot(int32_t slot_num);
+
+// Waits for the save to the given slot, if any, and returns true if the most
+// recent save to it failed to reach the disk.
+bool Savegame_DidWriteFail(int32_t slot_num);
+
+// Blocks until all pending saves have been written.
+void Savegame_WaitForWrites(void);
+
 extern int32_t Savegame_GetSlotCount(void);
 extern bool Savegame_IsSlotFree(int32_t slot_num);
 extern bool Savegame_Load(int32_t slot_num);
@@ -31,6 +31,13 @@ typedef struct {
     } combine_with;
 } GLYPH_INFO;
 
+// A single glyph sprite, already positioned in screen space.
+typedef struct {
+    int32_t x;
+    int32_t y;
+    int32_t sprite_num;
+} TEXT_GLYPH_SPRITE;
+
 typedef enum {
     TS_HEADING = 0,
     TS_BACKGROUND = 1,
@@ -97,6 +104,32 @@ typedef struct {
     char *content;
 
     const GLYPH_INFO **glyphs;
+
+    // Screen space geometry cached by the renderer across frames. The setters
+    // below mark it dirty; the renderer additionally rebuilds it whenever the
+    // screen resolution or the UI scale change.
+    struct {
+        bool is_dirty;
+        int32_t sprite_count;
+        TEXT_GLYPH_SPRITE *sprites;
+        struct {
+            int32_t h;
+            int32_t v;
+        } scale;
+        struct {
+            int32_t x;
+            int32_t y;
+            int32_t w;
+            int32_t h;
+        } box;
+        struct {
+            int32_t res_w;
+            int32_t res_h;
+            double ui_scale;
+            int32_t mesh_idx;
+            int32_t mesh_count;
+        } key;
+    } layout;
 } TEXTSTRING;
 
 extern int32_t Text_GetMaxLineLength(void);
@@ -23,12 +23,18 @@ typedef struct GFX_2D_RENDERER GFX_2D_RENDERER;
 GFX_2D_RENDERER *GFX_2D_Renderer_Create(void);
 void GFX_2D_Renderer_Destroy(GFX_2D_RENDERER *renderer);
 
+// The dirty rect limits the upload to the part of the surface that changed
+// since the previous upload. Passing nullptr uploads everything, unless the
+// data turns out to be identical to the last full upload.
 void GFX_2D_Renderer_UploadSurface(
-    GFX_2D_RENDERER *renderer, GFX_2D_SURFACE *surface);
+    GFX_2D_RENDERER *renderer, GFX_2D_SURFACE *surface,
+    const GFX_2D_RECT *dirty_rect);
 void GFX_2D_Renderer_UploadAlphaSurface(
-    GFX_2D_RENDERER *renderer, GFX_2D_SURFACE *surface);
+    GFX_2D_RENDERER *renderer, GFX_2D_SURFACE *surface,
+    const GFX_2D_RECT *dirty_rect);
 void GFX_2D_Renderer_Upload(
-    GFX_2D_RENDERER *renderer, GFX_2D_SURFACE_DESC *desc, const uint8_t *data);
+    GFX_2D_RENDERER *renderer, GFX_2D_SURFACE_DESC *desc, const uint8_t *data,
+    const GFX_2D_RECT *dirty_rect);
 
 void GFX_2D_Renderer_SetPalette(
     GFX_2D_RENDERER *renderer, const GFX_COLOR *palette);
@@ -25,6 +25,13 @@ typedef struct {
     GFX_2D_SURFACE_DESC desc;
 } GFX_2D_SURFACE;
 
+typedef struct {
+    int32_t x;
+    int32_t y;
+    int32_t w;
+    int32_t h;
+} GFX_2D_RECT;
+
 GFX_2D_SURFACE *GFX_2D_Surface_Create(const GFX_2D_SURFACE_DESC *desc);
 GFX_2D_SURFACE *GFX_2D_Surface_CreateFromImage(const IMAGE *image);
 void GFX_2D_Surface_Free(GFX_2D_SURFACE *surface);
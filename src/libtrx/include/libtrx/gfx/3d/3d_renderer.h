@@ -31,6 +31,11 @@ void GFX_3D_Renderer_RenderEnd(GFX_3D_RENDERER *renderer);
 void GFX_3D_Renderer_Flush(GFX_3D_RENDERER *renderer);
 void GFX_3D_Renderer_ClearDepth(GFX_3D_RENDERER *renderer);
 
+// Texture pages must be registered between these calls. Begin releases all
+// previously registered pages.
+void GFX_3D_Renderer_BeginTexturePages(
+    GFX_3D_RENDERER *renderer, int count, int width, int height);
+void GFX_3D_Renderer_EndTexturePages(GFX_3D_RENDERER *renderer);
 int GFX_3D_Renderer_RegisterTexturePage(
     GFX_3D_RENDERER *renderer, const void *data, int width, int height);
 bool GFX_3D_Renderer_UnregisterTexturePage(
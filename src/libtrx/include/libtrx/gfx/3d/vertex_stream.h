@@ -12,10 +12,14 @@ typedef struct {
     float x, y, z;
     float s, t, w;
     float r, g, b, a;
+    // Texture page layer, filled in by the stream. Negative values sample the
+    // environment map instead.
+    float layer;
 } GFX_3D_VERTEX;
 
 typedef struct {
     GFX_3D_PRIM_TYPE prim_type;
+    float layer;
     size_t buffer_size;
     GFX_GL_BUFFER buffer;
     GFX_GL_VERTEX_ARRAY vtc_format;
@@ -25,6 +29,7 @@ typedef struct {
         size_t capacity;
     } pending_vertices;
     size_t rendered_count;
+    size_t draw_count;
     size_t transferred;
 } GFX_3D_VERTEX_STREAM;
 
@@ -36,6 +41,10 @@ void GFX_3D_VertexStream_Bind(GFX_3D_VERTEX_STREAM *vertex_stream);
 void GFX_3D_VertexStream_SetPrimType(
     GFX_3D_VERTEX_STREAM *vertex_stream, GFX_3D_PRIM_TYPE prim_type);
 
+// Applies to every vertex pushed from now on, without breaking the batch.
+void GFX_3D_VertexStream_SetLayer(
+    GFX_3D_VERTEX_STREAM *vertex_stream, float layer);
+
 bool GFX_3D_VertexStream_PushPrimStrip(
     GFX_3D_VERTEX_STREAM *vertex_stream, const GFX_3D_VERTEX *vertices,
     int count);
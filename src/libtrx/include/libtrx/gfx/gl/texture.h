@@ -17,4 +17,12 @@ void GFX_GL_Texture_Bind(GFX_GL_TEXTURE *texture);
 void GFX_GL_Texture_Load(
     GFX_GL_TEXTURE *texture, const void *data, int width, int height,
     GLint internal_format, GLint format);
-void GFX_GL_Texture_LoadFromBackBuffer(GFX_GL_TEXTURE *texture);
+
+// Array textures get their storage for all layers and mipmap levels up front.
+// Layers are then filled one by one, and the mipmaps built once at the end.
+void GFX_GL_Texture_AllocateLayers(
+    GFX_GL_TEXTURE *texture, int width, int height, int layer_count);
+void GFX_GL_Texture_LoadLayer(
+    GFX_GL_TEXTURE *texture, int layer, const void *data, int width,
+    int height, GLint format);
+void GFX_GL_Texture_GenerateMipmaps(GFX_GL_TEXTURE *texture);
@@ -2,6 +2,8 @@
 
 #include <stddef.h>
 
+#include <stdint.h>
+
 // Basic memory utilities that exit the game in case the system runs out of
 // memory.
 
@@ -20,6 +22,15 @@ typedef struct {
     size_t default_chunk_size;
 } MEMORY_ARENA_ALLOCATOR;
 
+typedef struct {
+    // Counters of the last completed frame.
+    int32_t allocs;
+    size_t bytes;
+    // Highest values seen so far.
+    int32_t peak_allocs;
+    size_t peak_bytes;
+} MEMORY_FRAME_STATS;
+
 // Allocate n bytes. In case the memory allocation fails, shows an error to the
 // user and exits the application. The allocated memory is filled with zeros.
 void *Memory_Alloc(size_t size);
@@ -69,3 +80,19 @@ void Memory_ArenaReset(MEMORY_ARENA_ALLOCATOR *allocator);
 // Frees the entire buffer owned by the arena allocator. allocator must not be
 // nullptr.
 void Memory_ArenaFree(MEMORY_ARENA_ALLOCATOR *allocator);
+
+// Allocate n bytes of scratch memory that stays valid only until the end of
+// the current frame, when it is reclaimed all at once by Memory_FrameReset.
+// Meant for short-lived buffers in hot paths that would otherwise hit the
+// system allocator on every call. The memory is not zeroed. Must only be used
+// from the main thread.
+void *Memory_FrameAlloc(size_t size);
+
+// Reclaims all scratch memory handed out by Memory_FrameAlloc. Called by the
+// phase executor once per drawn frame.
+void Memory_FrameReset(void);
+
+// Frees the scratch memory pool.
+void Memory_FrameShutdown(void);
+
+const MEMORY_FRAME_STATS *Memory_GetFrameStats(void);
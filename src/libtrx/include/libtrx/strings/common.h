@@ -4,6 +4,9 @@
 
 #include <stdint.h>
 
+// Frees the compiled regexes kept around by String_Match.
+void String_Shutdown(void);
+
 bool String_EndsWith(const char *str, const char *suffix);
 bool String_Equivalent(const char *a, const char *b);
 
@@ -1,6 +1,6 @@
 #pragma once
 
-#include "../vector.h"
+#include "../typed_vector.h"
 
 #include <stdint.h>
 
@@ -22,6 +22,32 @@ typedef struct {
     STRING_FUZZY_SCORE score;
 } STRING_FUZZY_MATCH;
 
-// Takes a vector of STRING_FUZZY_SOURCE.
-// Returns a vector of STRING_FUZZY_MATCH.
-VECTOR *String_FuzzyMatch(const char *user_input, const VECTOR *source);
+DECLARE_VECTOR(STRING_FUZZY_SOURCE, STRING_FUZZY_SOURCE)
+DECLARE_VECTOR(STRING_FUZZY_MATCH, STRING_FUZZY_MATCH)
+DECLARE_VECTOR(STRING_FUZZY_POSTINGS, int32_t)
+
+#define STRING_FUZZY_INDEX_BUCKETS 1024
+
+// Trigram index over the keys of a source vector, used to skip the items
+// that cannot possibly match before scoring the rest. The source must outlive
+// the index and must not change while the index is in use.
+typedef struct {
+    const STRING_FUZZY_SOURCE_VECTOR *source;
+    STRING_FUZZY_POSTINGS_VECTOR buckets[STRING_FUZZY_INDEX_BUCKETS];
+} STRING_FUZZY_INDEX;
+
+// Returns the matches sorted best first. The caller frees the result with
+// STRING_FUZZY_MATCH_Vector_Free.
+STRING_FUZZY_MATCH_VECTOR String_FuzzyMatch(
+    const char *user_input, const STRING_FUZZY_SOURCE_VECTOR *source);
+
+void String_FuzzyIndex_Build(
+    STRING_FUZZY_INDEX *index, const STRING_FUZZY_SOURCE_VECTOR *source);
+void String_FuzzyIndex_Free(STRING_FUZZY_INDEX *index);
+
+// Fills out with the source items that may match the user input, in source
+// order. Feeding the result to String_FuzzyMatch yields the same matches in
+// the same order as matching against the whole source.
+void String_FuzzyIndex_Filter(
+    const STRING_FUZZY_INDEX *index, const char *user_input,
+    STRING_FUZZY_SOURCE_VECTOR *out);
@@ -0,0 +1,163 @@
+#pragma once
+
+// Header-only, type-specialized vectors.
+//
+// Unlike VECTOR, which stores items behind an opaque pointer and copies them
+// through memcpy, these expose a typed item array, so lookups compile down to
+// plain array accesses and swaps use a stack temporary.
+//
+// DECLARE_VECTOR(NAME, TYPE) generates NAME_VECTOR and NAME_Vector_* functions.
+// A zero-initialized NAME_VECTOR is a valid empty vector.
+//
+// DECLARE_SMALL_VECTOR(NAME, TYPE, N) additionally embeds storage for N items
+// in the struct itself and only touches the heap once that overflows. Such
+// vectors must be initialized with NAME_Vector_Init and must not be copied by
+// value, as items may point into the struct.
+
+#include "./debug.h"
+#include "./memory.h"
+
+#include <stdint.h>
+#include <string.h>
+
+#define TYPED_VECTOR_DEFAULT_CAPACITY 4
+#define TYPED_VECTOR_GROWTH_RATE 2
+
+#define DECLARE_VECTOR(name, type)                                             \
+    typedef struct {                                                           \
+        int32_t count;                                                         \
+        int32_t capacity;                                                      \
+        type *items;                                                           \
+    } name##_VECTOR;                                                           \
+                                                                               \
+    static inline type *name##_Vector_M_GetInlineItems(                        \
+        name##_VECTOR *const vector)                                           \
+    {                                                                          \
+        (void)vector;                                                          \
+        return nullptr;                                                        \
+    }                                                                          \
+                                                                               \
+    M_TYPED_VECTOR_DEFINE_FUNCS(name, type, 0)
+
+#define DECLARE_SMALL_VECTOR(name, type, inline_capacity)                      \
+    typedef struct {                                                           \
+        int32_t count;                                                         \
+        int32_t capacity;                                                      \
+        type *items;                                                           \
+        type inline_items[inline_capacity];                                    \
+    } name##_VECTOR;                                                           \
+                                                                               \
+    static inline type *name##_Vector_M_GetInlineItems(                        \
+        name##_VECTOR *const vector)                                           \
+    {                                                                          \
+        return vector->inline_items;                                           \
+    }                                                                          \
+                                                                               \
+    M_TYPED_VECTOR_DEFINE_FUNCS(name, type, inline_capacity)
+
+#define M_TYPED_VECTOR_DEFINE_FUNCS(name, type, inline_capacity)               \
+    static inline void name##_Vector_Init(name##_VECTOR *const vector)         \
+    {                                                                          \
+        vector->count = 0;                                                     \
+        vector->capacity = (inline_capacity);                                  \
+        vector->items = name##_Vector_M_GetInlineItems(vector);                \
+    }                                                                          \
+                                                                               \
+    static inline void name##_Vector_Free(name##_VECTOR *const vector)         \
+    {                                                                          \
+        if (vector->items != name##_Vector_M_GetInlineItems(vector)) {         \
+            Memory_Free(vector->items);                                        \
+        }                                                                      \
+        name##_Vector_Init(vector);                                            \
+    }                                                                          \
+                                                                               \
+    static inline void name##_Vector_Reserve(                                  \
+        name##_VECTOR *const vector, const int32_t capacity)                   \
+    {                                                                          \
+        if (capacity <= vector->capacity) {                                    \
+            return;                                                            \
+        }                                                                      \
+        int32_t new_capacity =                                                 \
+            vector->capacity * TYPED_VECTOR_GROWTH_RATE;                       \
+        if (new_capacity < TYPED_VECTOR_DEFAULT_CAPACITY) {                    \
+            new_capacity = TYPED_VECTOR_DEFAULT_CAPACITY;                      \
+        }                                                                      \
+        if (new_capacity < capacity) {                                         \
+            new_capacity = capacity;                                           \
+        }                                                                      \
+        if (vector->items == name##_Vector_M_GetInlineItems(vector)) {         \
+            type *const items = Memory_Alloc(sizeof(type) * new_capacity);     \
+            if (vector->count > 0) {                                           \
+                memcpy(items, vector->items, sizeof(type) * vector->count);    \
+            }                                                                  \
+            vector->items = items;                                             \
+        } else {                                                               \
+            vector->items =                                                    \
+                Memory_Realloc(vector->items, sizeof(type) * new_capacity);    \
+        }                                                                      \
+        vector->capacity = new_capacity;                                       \
+    }                                                                          \
+                                                                               \
+    static inline type *name##_Vector_Get(                                     \
+        name##_VECTOR *const vector, const int32_t index)                      \
+    {                                                                          \
+        ASSERT(index >= 0 && index < vector->count);                           \
+        return &vector->items[index];                                          \
+    }                                                                          \
+                                                                               \
+    static inline void name##_Vector_Push(                                     \
+        name##_VECTOR *const vector, type item)                                \
+    {                                                                          \
+        if (vector->count == vector->capacity) {                               \
+            name##_Vector_Reserve(vector, vector->count + 1);                  \
+        }                                                                      \
+        vector->items[vector->count++] = item;                                 \
+    }                                                                          \
+                                                                               \
+    static inline void name##_Vector_Insert(                                   \
+        name##_VECTOR *const vector, const int32_t index, type item)           \
+    {                                                                          \
+        ASSERT(index >= 0 && index <= vector->count);                          \
+        if (vector->count == vector->capacity) {                               \
+            name##_Vector_Reserve(vector, vector->count + 1);                  \
+        }                                                                      \
+        memmove(                                                               \
+            &vector->items[index + 1], &vector->items[index],                  \
+            sizeof(type) * (vector->count - index));                           \
+        vector->items[index] = item;                                           \
+        vector->count++;                                                       \
+    }                                                                          \
+                                                                               \
+    static inline void name##_Vector_RemoveAt(                                 \
+        name##_VECTOR *const vector, const int32_t index)                      \
+    {                                                                          \
+        ASSERT(index >= 0 && index < vector->count);                           \
+        memmove(                                                               \
+            &vector->items[index], &vector->items[index + 1],                  \
+            sizeof(type) * (vector->count - index - 1));                       \
+        vector->count--;                                                       \
+    }                                                                          \
+                                                                               \
+    static inline void name##_Vector_Swap(                                     \
+        name##_VECTOR *const vector, const int32_t index1,                     \
+        const int32_t index2)                                                  \
+    {                                                                          \
+        ASSERT(index1 >= 0 && index1 < vector->count);                         \
+        ASSERT(index2 >= 0 && index2 < vector->count);                         \
+        type tmp = vector->items[index1];                                      \
+        vector->items[index1] = vector->items[index2];                         \
+        vector->items[index2] = tmp;                                           \
+    }                                                                          \
+                                                                               \
+    static inline void name##_Vector_Reverse(name##_VECTOR *const vector)      \
+    {                                                                          \
+        for (int32_t i = 0, j = vector->count - 1; i < j; i++, j--) {          \
+            name##_Vector_Swap(vector, i, j);                                  \
+        }                                                                      \
+    }                                                                          \
+                                                                               \
+    /* Keeps the current allocation around for reuse. */                       \
+    static inline void name##_Vector_Clear(name##_VECTOR *const vector)        \
+    {                                                                          \
+        vector->count = 0;                                                     \
+    }
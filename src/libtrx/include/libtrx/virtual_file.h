@@ -3,13 +3,24 @@
 #include <stddef.h>
 #include <stdint.h>
 
+typedef enum {
+    // The content is a heap copy released on close.
+    VFILE_STORAGE_OWNED,
+    // The content is a read-only memory mapping of the file on disk.
+    VFILE_STORAGE_MAPPED,
+} VFILE_STORAGE;
+
 typedef struct {
-    char *content;
+    const char *content;
     size_t size;
-    char *cur_ptr;
+    const char *cur_ptr;
+    VFILE_STORAGE storage;
 } VFILE;
 
+// Memory-maps the file where the platform supports it, falling back to
+// reading it into a heap buffer.
 VFILE *VFile_CreateFromPath(const char *path);
+// Copies the buffer; the caller is free to release it afterwards.
 VFILE *VFile_CreateFromBuffer(const char *data, size_t size);
 void VFile_Close(VFILE *file);
 
@@ -3,9 +3,20 @@
 #include "debug.h"
 #include "utils.h"
 
+#include <SDL2/SDL_thread.h>
 #include <stdlib.h>
 #include <string.h>
 
+static MEMORY_ARENA_ALLOCATOR m_FrameAllocator = {
+    .default_chunk_size = 64 * 1024,
+};
+static MEMORY_FRAME_STATS m_FrameStats = {};
+static int32_t m_FrameAllocs = 0;
+static size_t m_FrameBytes = 0;
+// The scratch arena has no locking, so it is bound to the first thread that
+// uses it, which is the main thread.
+static SDL_threadID m_FrameThread = 0;
+
 static MEMORY_ARENA_CHUNK *M_ArenaAllocChunk(
     MEMORY_ARENA_ALLOCATOR *allocator, size_t size);
 
@@ -123,3 +134,39 @@ void Memory_ArenaFree(MEMORY_ARENA_ALLOCATOR *const allocator)
         chunk = next;
     }
 }
+
+void *Memory_FrameAlloc(const size_t size)
+{
+    if (m_FrameThread == 0) {
+        m_FrameThread = SDL_ThreadID();
+    }
+    ASSERT(SDL_ThreadID() == m_FrameThread);
+
+    const size_t aligned_size = (size + 7) & ~(size_t)7;
+    m_FrameAllocs++;
+    m_FrameBytes += aligned_size;
+    return Memory_ArenaAlloc(&m_FrameAllocator, aligned_size);
+}
+
+void Memory_FrameReset(void)
+{
+    m_FrameStats.allocs = m_FrameAllocs;
+    m_FrameStats.bytes = m_FrameBytes;
+    m_FrameStats.peak_allocs = MAX(m_FrameStats.peak_allocs, m_FrameAllocs);
+    m_FrameStats.peak_bytes = MAX(m_FrameStats.peak_bytes, m_FrameBytes);
+    m_FrameAllocs = 0;
+    m_FrameBytes = 0;
+    Memory_ArenaReset(&m_FrameAllocator);
+}
+
+void Memory_FrameShutdown(void)
+{
+    Memory_ArenaFree(&m_FrameAllocator);
+    m_FrameAllocator.first_chunk = nullptr;
+    m_FrameAllocator.current_chunk = nullptr;
+}
+
+const MEMORY_FRAME_STATS *Memory_GetFrameStats(void)
+{
+    return &m_FrameStats;
+}
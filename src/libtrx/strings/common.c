@@ -1,15 +1,37 @@
+#include "debug.h"
 #include "log.h"
 #include "memory.h"
 #include "strings.h"
 #include "utils.h"
 
+#include <SDL2/SDL_thread.h>
 #include <ctype.h>
 #include <pcre2.h>
 #include <stdio.h>
 #include <string.h>
 
+#define REGEX_CACHE_SIZE 32
+#define REGEX_OVECTOR_SIZE 128
+
+typedef struct {
+    char *pattern;
+    uint32_t options;
+    pcre2_code *code;
+    uint32_t last_used;
+} REGEX_CACHE_ENTRY;
+
+// Compiled patterns are kept around since the same handful of regexes is
+// matched over and over by the console and the config parsers. The cache has
+// no locking, so it is bound to the first thread that matches anything, which
+// is the main thread.
+static REGEX_CACHE_ENTRY m_RegexCache[REGEX_CACHE_SIZE] = {};
+static SDL_threadID m_RegexThread = 0;
+static uint32_t m_RegexCacheClock = 0;
+static pcre2_match_data *m_MatchData = nullptr;
+
 static void M_AddPage(
     const char *text, int32_t start_pos, int32_t length, VECTOR *pages);
+static const pcre2_code *M_GetRegex(const char *pattern, uint32_t options);
 
 static void M_AddPage(
     const char *text, const int32_t start_pos, const int32_t length,
@@ -23,6 +45,71 @@ static void M_AddPage(
     Vector_Add(pages, &page);
 }
 
+static const pcre2_code *M_GetRegex(
+    const char *const pattern, const uint32_t options)
+{
+    if (m_RegexThread == 0) {
+        m_RegexThread = SDL_ThreadID();
+    }
+    ASSERT(SDL_ThreadID() == m_RegexThread);
+
+    REGEX_CACHE_ENTRY *victim = &m_RegexCache[0];
+    for (int32_t i = 0; i < REGEX_CACHE_SIZE; i++) {
+        REGEX_CACHE_ENTRY *const entry = &m_RegexCache[i];
+        if (entry->code == nullptr) {
+            victim = entry;
+            break;
+        }
+        if (entry->options == options && !strcmp(entry->pattern, pattern)) {
+            entry->last_used = ++m_RegexCacheClock;
+            return entry->code;
+        }
+        if (entry->last_used < victim->last_used) {
+            victim = entry;
+        }
+    }
+
+    int err_code;
+    PCRE2_SIZE err_offset;
+    pcre2_code *const code = pcre2_compile(
+        (PCRE2_SPTR)pattern, PCRE2_ZERO_TERMINATED, options, &err_code,
+        &err_offset, nullptr);
+    if (code == nullptr) {
+        PCRE2_UCHAR8 buffer[128];
+        pcre2_get_error_message(err_code, buffer, 120);
+        LOG_ERROR("%d\t%s", err_code, buffer);
+        return nullptr;
+    }
+    // Falls back to the interpreter if JIT is unavailable on this platform.
+    pcre2_jit_compile(code, PCRE2_JIT_COMPLETE);
+
+    if (victim->code != nullptr) {
+        pcre2_code_free(victim->code);
+        Memory_FreePointer(&victim->pattern);
+    }
+    victim->pattern = Memory_DupStr(pattern);
+    victim->options = options;
+    victim->code = code;
+    victim->last_used = ++m_RegexCacheClock;
+    return code;
+}
+
+void String_Shutdown(void)
+{
+    for (int32_t i = 0; i < REGEX_CACHE_SIZE; i++) {
+        REGEX_CACHE_ENTRY *const entry = &m_RegexCache[i];
+        if (entry->code != nullptr) {
+            pcre2_code_free(entry->code);
+            entry->code = nullptr;
+        }
+        Memory_FreePointer(&entry->pattern);
+    }
+    if (m_MatchData != nullptr) {
+        pcre2_match_data_free(m_MatchData);
+        m_MatchData = nullptr;
+    }
+}
+
 bool String_EndsWith(const char *str, const char *suffix)
 {
     int str_len = strlen(str);
@@ -91,32 +178,17 @@ bool String_Match(const char *const subject, const char *const pattern)
         return 0;
     }
 
-    const unsigned char *const usubject = (const unsigned char *)subject;
-    const unsigned char *const upattern = (const unsigned char *)pattern;
-    const uint32_t options = PCRE2_CASELESS;
-
-    const uint32_t ovec_size = 128;
-
-    int err_code;
-    PCRE2_SIZE err_offset;
-    pcre2_code *const re = pcre2_compile(
-        upattern, PCRE2_ZERO_TERMINATED, options, &err_code, &err_offset,
-        nullptr);
+    const pcre2_code *const re = M_GetRegex(pattern, PCRE2_CASELESS);
     if (re == nullptr) {
-        PCRE2_UCHAR8 buffer[128];
-        pcre2_get_error_message(err_code, buffer, 120);
-        LOG_ERROR("%d\t%s", err_code, buffer);
         return false;
     }
 
-    pcre2_match_data *const match_data =
-        pcre2_match_data_create(ovec_size, nullptr);
-    const int flags = 0;
+    if (m_MatchData == nullptr) {
+        m_MatchData = pcre2_match_data_create(REGEX_OVECTOR_SIZE, nullptr);
+    }
     const int rc = pcre2_match(
-        re, usubject, PCRE2_ZERO_TERMINATED, 0, flags, match_data, nullptr);
-    pcre2_match_data_free(match_data);
-    pcre2_code_free(re);
-
+        re, (PCRE2_SPTR)subject, PCRE2_ZERO_TERMINATED, 0, 0, m_MatchData,
+        nullptr);
     return rc > 0;
 }
 
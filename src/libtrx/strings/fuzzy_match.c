@@ -3,6 +3,7 @@
 #include "memory.h"
 #include "strings/common.h"
 
+#include <ctype.h>
 #include <stdio.h>
 #include <string.h>
 
@@ -10,13 +11,16 @@
 #define WORD_MATCH_SCORE_BONUS 50
 #define PERCENT_MATCH_SCORE 50
 #define LETTER_MATCH_SCORE_BONUS 1
+#define TRIGRAM_SIZE 3
+#define REGEX_SPECIAL_CHARS "\\^$.|?*+()[]{}"
 
 static STRING_FUZZY_SCORE M_GetScore(
     const char *user_input, const char *reference, int32_t weight);
-static void M_DiscardNonFullMatches(VECTOR *matches);
-static void M_DiscardNonWordMatches(VECTOR *matches);
-static void M_SortMatches(VECTOR *matches);
-static void M_DiscardDuplicateMatches(VECTOR *matches);
+static void M_DiscardNonFullMatches(STRING_FUZZY_MATCH_VECTOR *matches);
+static void M_DiscardNonWordMatches(STRING_FUZZY_MATCH_VECTOR *matches);
+static void M_SortMatches(STRING_FUZZY_MATCH_VECTOR *matches);
+static void M_DiscardDuplicateMatches(STRING_FUZZY_MATCH_VECTOR *matches);
+static int32_t M_GetTrigramBucket(const char *str);
 
 static STRING_FUZZY_SCORE M_GetScore(
     const char *const user_input, const char *const reference,
@@ -26,8 +30,8 @@ static STRING_FUZZY_SCORE M_GetScore(
         PERCENT_MATCH_SCORE * strlen(user_input) / strlen(reference);
     const int32_t letter_score = LETTER_MATCH_SCORE_BONUS * strlen(user_input);
 
-    char *word_regex = Memory_Alloc(strlen(user_input) + 20);
-    char *full_regex = Memory_Alloc(strlen(user_input) + 20);
+    char *const word_regex = Memory_FrameAlloc(strlen(user_input) + 20);
+    char *const full_regex = Memory_FrameAlloc(strlen(user_input) + 20);
     sprintf(word_regex, "\\b%s\\b", user_input);
     sprintf(full_regex, "^\\s*%s\\s*$", user_input);
 
@@ -48,9 +52,6 @@ static STRING_FUZZY_SCORE M_GetScore(
         score = 0;
     }
 
-    Memory_FreePointer(&word_regex);
-    Memory_FreePointer(&full_regex);
-
     return (STRING_FUZZY_SCORE) {
         .is_full = is_full,
         .is_word = is_word,
@@ -58,84 +59,83 @@ static STRING_FUZZY_SCORE M_GetScore(
     };
 }
 
-static void M_DiscardNonFullMatches(VECTOR *const matches)
+static void M_DiscardNonFullMatches(STRING_FUZZY_MATCH_VECTOR *const matches)
 {
     bool has_full_match = false;
     for (int32_t i = 0; i < matches->count; i++) {
-        const STRING_FUZZY_MATCH *const match = Vector_Get(matches, i);
+        const STRING_FUZZY_MATCH *const match = &matches->items[i];
         if (match->score.is_full) {
             has_full_match = true;
         }
     }
     if (has_full_match) {
         for (int32_t i = matches->count - 1; i >= 0; i--) {
-            const STRING_FUZZY_MATCH *const match = Vector_Get(matches, i);
+            const STRING_FUZZY_MATCH *const match = &matches->items[i];
             if (!match->score.is_full) {
-                Vector_RemoveAt(matches, i);
+                STRING_FUZZY_MATCH_Vector_RemoveAt(matches, i);
             }
         }
     }
 }
 
-static void M_DiscardNonWordMatches(VECTOR *const matches)
+static void M_DiscardNonWordMatches(STRING_FUZZY_MATCH_VECTOR *const matches)
 {
     bool has_word_match = false;
     for (int32_t i = 0; i < matches->count; i++) {
-        const STRING_FUZZY_MATCH *const match = Vector_Get(matches, i);
+        const STRING_FUZZY_MATCH *const match = &matches->items[i];
         if (match->score.is_word) {
             has_word_match = true;
         }
     }
     if (has_word_match) {
         for (int32_t i = matches->count - 1; i >= 0; i--) {
-            const STRING_FUZZY_MATCH *const match = Vector_Get(matches, i);
+            const STRING_FUZZY_MATCH *const match = &matches->items[i];
             if (!match->score.is_word) {
-                Vector_RemoveAt(matches, i);
+                STRING_FUZZY_MATCH_Vector_RemoveAt(matches, i);
             }
         }
     }
 }
 
-static void M_SortMatches(VECTOR *const matches)
+static void M_SortMatches(STRING_FUZZY_MATCH_VECTOR *const matches)
 {
     // sort by match length so that best-matching results appear first
     for (int32_t i = 0; i < matches->count; i++) {
-        const STRING_FUZZY_MATCH *const match_1 = Vector_Get(matches, i);
+        const STRING_FUZZY_MATCH *const match_1 = &matches->items[i];
         for (int32_t j = i + 1; j < matches->count; j++) {
-            const STRING_FUZZY_MATCH *const match_2 = Vector_Get(matches, j);
+            const STRING_FUZZY_MATCH *const match_2 = &matches->items[j];
             if (match_1->score.score < match_2->score.score) {
-                Vector_Swap(matches, i, j);
+                STRING_FUZZY_MATCH_Vector_Swap(matches, i, j);
             }
         }
     }
 }
 
-static void M_DiscardDuplicateMatches(VECTOR *const matches)
+static void M_DiscardDuplicateMatches(STRING_FUZZY_MATCH_VECTOR *const matches)
 {
     for (int32_t i = matches->count - 1; i >= 0; i--) {
-        const STRING_FUZZY_MATCH *const match = Vector_Get(matches, i);
+        const STRING_FUZZY_MATCH *const match = &matches->items[i];
         bool is_unique = true;
         for (int32_t j = 0; j < matches->count; j++) {
-            const STRING_FUZZY_MATCH *const other_match =
-                Vector_Get(matches, j);
+            const STRING_FUZZY_MATCH *const other_match = &matches->items[j];
             if (j != i && match->value == other_match->value) {
                 is_unique = false;
                 break;
             }
         }
         if (!is_unique) {
-            Vector_RemoveAt(matches, i);
+            STRING_FUZZY_MATCH_Vector_RemoveAt(matches, i);
         }
     }
 }
 
-VECTOR *String_FuzzyMatch(const char *user_input, const VECTOR *const source)
+STRING_FUZZY_MATCH_VECTOR String_FuzzyMatch(
+    const char *user_input, const STRING_FUZZY_SOURCE_VECTOR *const source)
 {
-    VECTOR *matches = Vector_Create(sizeof(STRING_FUZZY_MATCH));
+    STRING_FUZZY_MATCH_VECTOR matches = {};
 
     for (int32_t i = 0; i < source->count; i++) {
-        const STRING_FUZZY_SOURCE *const source_item =
-            Vector_Get((VECTOR *)source, i);
+        const STRING_FUZZY_SOURCE *const source_item = &source->items[i];
         const STRING_FUZZY_SCORE score =
             M_GetScore(user_input, source_item->key, source_item->weight);
 
@@ -143,18 +143,91 @@ VECTOR *String_FuzzyMatch(const char *user_input, const VECTOR *const source)
             continue;
         }
 
-        STRING_FUZZY_MATCH match = {
+        const STRING_FUZZY_MATCH match = {
             .key = source_item->key,
             .value = source_item->value,
             .score = score,
         };
-        Vector_Add(matches, &match);
+        STRING_FUZZY_MATCH_Vector_Push(&matches, match);
     }
 
-    M_DiscardNonFullMatches(matches);
-    M_DiscardNonWordMatches(matches);
-    M_DiscardDuplicateMatches(matches);
-    M_SortMatches(matches);
+    M_DiscardNonFullMatches(&matches);
+    M_DiscardNonWordMatches(&matches);
+    M_DiscardDuplicateMatches(&matches);
+    M_SortMatches(&matches);
 
     return matches;
 }
+
+static int32_t M_GetTrigramBucket(const char *const str)
+{
+    uint32_t hash = 0;
+    for (int32_t i = 0; i < TRIGRAM_SIZE; i++) {
+        hash = hash * 31 + (uint32_t)tolower((unsigned char)str[i]);
+    }
+    return hash % STRING_FUZZY_INDEX_BUCKETS;
+}
+
+void String_FuzzyIndex_Build(
+    STRING_FUZZY_INDEX *const index,
+    const STRING_FUZZY_SOURCE_VECTOR *const source)
+{
+    index->source = source;
+    for (int32_t i = 0; i < source->count; i++) {
+        const char *const key = source->items[i].key;
+        const int32_t key_len = strlen(key);
+        for (int32_t j = 0; j + TRIGRAM_SIZE <= key_len; j++) {
+            STRING_FUZZY_POSTINGS_VECTOR *const postings =
+                &index->buckets[M_GetTrigramBucket(&key[j])];
+            if (postings->count == 0
+                || postings->items[postings->count - 1] != i) {
+                STRING_FUZZY_POSTINGS_Vector_Push(postings, i);
+            }
+        }
+    }
+}
+
+void String_FuzzyIndex_Free(STRING_FUZZY_INDEX *const index)
+{
+    for (int32_t i = 0; i < STRING_FUZZY_INDEX_BUCKETS; i++) {
+        STRING_FUZZY_POSTINGS_Vector_Free(&index->buckets[i]);
+    }
+    index->source = nullptr;
+}
+
+void String_FuzzyIndex_Filter(
+    const STRING_FUZZY_INDEX *const index, const char *const user_input,
+    STRING_FUZZY_SOURCE_VECTOR *const out)
+{
+    const STRING_FUZZY_SOURCE_VECTOR *const source = index->source;
+
+    // The input is matched as a regex, so only literal input is guaranteed to
+    // appear verbatim in every key that scores.
+    if (strpbrk(user_input, REGEX_SPECIAL_CHARS) != nullptr) {
+        for (int32_t i = 0; i < source->count; i++) {
+            STRING_FUZZY_SOURCE_Vector_Push(out, source->items[i]);
+        }
+        return;
+    }
+
+    // Any trigram of the input has to be present in a matching key, so it is
+    // enough to look at the shortest postings list.
+    const STRING_FUZZY_POSTINGS_VECTOR *best = nullptr;
+    const int32_t input_len = strlen(user_input);
+    for (int32_t i = 0; i + TRIGRAM_SIZE <= input_len; i++) {
+        const STRING_FUZZY_POSTINGS_VECTOR *const postings =
+            &index->buckets[M_GetTrigramBucket(&user_input[i])];
+        if (best == nullptr || postings->count < best->count) {
+            best = postings;
+        }
+    }
+
+    const int32_t count = best != nullptr ? best->count : source->count;
+    for (int32_t i = 0; i < count; i++) {
+        const int32_t item_idx = best != nullptr ? best->items[i] : i;
+        const STRING_FUZZY_SOURCE *const item = &source->items[item_idx];
+        if (String_CaseSubstring(item->key, user_input) != nullptr) {
+            STRING_FUZZY_SOURCE_Vector_Push(out, *item);
+        }
+    }
+}
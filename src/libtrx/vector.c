@@ -2,12 +2,14 @@
 
 #include "debug.h"
 #include "memory.h"
+#include "utils.h"
 
 #include <stdint.h>
 #include <string.h>
 
 #define VECTOR_DEFAULT_CAPACITY 4
 #define VECTOR_GROWTH_RATE 2
+#define VECTOR_SWAP_CHUNK 64
 #define P(obj) ((*obj->priv))
 
 struct VECTOR_PRIV {
@@ -15,6 +17,7 @@ struct VECTOR_PRIV {
 };
 
 static void M_EnsureCapacity(VECTOR *vector, int32_t n);
+static void M_SwapItems(char *item1, char *item2, size_t item_size);
 
 static void M_EnsureCapacity(VECTOR *const vector, const int32_t n)
 {
@@ -25,6 +28,24 @@ static void M_EnsureCapacity(VECTOR *const vector, const int32_t n)
     }
 }
 
+static void M_SwapItems(
+    char *item1, char *item2, const size_t item_size)
+{
+    // Items are swapped in small pieces through the stack, so that no
+    // temporary has to be allocated however large they are.
+    char tmp[VECTOR_SWAP_CHUNK];
+    size_t remaining = item_size;
+    while (remaining > 0) {
+        const size_t size = MIN(remaining, sizeof(tmp));
+        memcpy(tmp, item1, size);
+        memcpy(item1, item2, size);
+        memcpy(item2, tmp, size);
+        item1 += size;
+        item2 += size;
+        remaining -= size;
+    }
+}
+
 VECTOR *Vector_Create(const size_t item_size)
 {
     return Vector_CreateAtCapacity(item_size, VECTOR_DEFAULT_CAPACITY);
@@ -116,13 +137,9 @@ void Vector_Swap(
         return;
     }
     char *const items = P(vector).items;
-    void *tmp = Memory_Alloc(vector->item_size);
-    memcpy(tmp, items + index1 * vector->item_size, vector->item_size);
-    memcpy(
+    M_SwapItems(
         items + index1 * vector->item_size, items + index2 * vector->item_size,
         vector->item_size);
-    memcpy(items + index2 * vector->item_size, tmp, vector->item_size);
-    Memory_FreePointer(&tmp);
 }
 
 bool Vector_Remove(VECTOR *const vector, const void *item)
@@ -153,16 +170,12 @@ void Vector_Reverse(VECTOR *const vector)
 {
     int32_t i = 0;
     int32_t j = vector->count - 1;
-    void *tmp = Memory_Alloc(vector->item_size);
     char *const items = P(vector).items;
     for (; i < j; i++, j--) {
-        memcpy(tmp, items + i * vector->item_size, vector->item_size);
-        memcpy(
+        M_SwapItems(
             items + i * vector->item_size, items + j * vector->item_size,
             vector->item_size);
-        memcpy(items + j * vector->item_size, tmp, vector->item_size);
     }
-    Memory_FreePointer(&tmp);
 }
 
 void Vector_Clear(VECTOR *const vector)
@@ -7,7 +7,62 @@
 
 #include <string.h>
 
-VFILE *VFile_CreateFromPath(const char *const path)
+#if !defined(_WIN32)
+    #include <fcntl.h>
+    #include <sys/mman.h>
+    #include <sys/stat.h>
+    #include <unistd.h>
+#endif
+
+static VFILE *M_Create(const char *data, size_t size, VFILE_STORAGE storage);
+static VFILE *M_CreateMapped(const char *path);
+static VFILE *M_CreateRead(const char *path);
+
+static VFILE *M_Create(
+    const char *const data, const size_t size, const VFILE_STORAGE storage)
+{
+    VFILE *const file = Memory_Alloc(sizeof(VFILE));
+    file->content = data;
+    file->size = size;
+    file->cur_ptr = file->content;
+    file->storage = storage;
+    return file;
+}
+
+static VFILE *M_CreateMapped(const char *const path)
+{
+#if defined(_WIN32)
+    return nullptr;
+#else
+    char *full_path = File_GetFullPath(path);
+    const int fd = open(full_path, O_RDONLY);
+    Memory_FreePointer(&full_path);
+    if (fd < 0) {
+        return nullptr;
+    }
+
+    struct stat st;
+    if (fstat(fd, &st) != 0 || st.st_size <= 0) {
+        close(fd);
+        return nullptr;
+    }
+
+    const size_t data_size = (size_t)st.st_size;
+    void *const data = mmap(nullptr, data_size, PROT_READ, MAP_PRIVATE, fd, 0);
+    // The mapping keeps its own reference to the file.
+    close(fd);
+    if (data == MAP_FAILED) {
+        return nullptr;
+    }
+
+    // Level loaders mostly read front to back, so let the kernel read ahead
+    // aggressively and drop the pages behind us.
+    madvise(data, data_size, MADV_SEQUENTIAL);
+    return M_Create(data, data_size, VFILE_STORAGE_MAPPED);
+#endif
+}
+
+static VFILE *M_CreateRead(const char *const path)
 {
     MYFILE *fp = File_Open(path, FILE_OPEN_READ);
     if (!fp) {
@@ -26,26 +81,36 @@ VFILE *VFile_CreateFromPath(const char *const path)
     }
     File_Close(fp);
 
-    VFILE *const file = Memory_Alloc(sizeof(VFILE));
-    file->content = data;
-    file->size = data_size;
-    file->cur_ptr = file->content;
-    return file;
+    return M_Create(data, data_size, VFILE_STORAGE_OWNED);
+}
+
+VFILE *VFile_CreateFromPath(const char *const path)
+{
+    VFILE *const file = M_CreateMapped(path);
+    if (file != nullptr) {
+        return file;
+    }
+    return M_CreateRead(path);
 }
 
 VFILE *VFile_CreateFromBuffer(const char *data, size_t size)
 {
-    VFILE *const file = Memory_Alloc(sizeof(VFILE));
-    file->content = Memory_Dup(data, size);
-    file->size = size;
-    file->cur_ptr = file->content;
-    return file;
+    return M_Create(Memory_Dup(data, size), size, VFILE_STORAGE_OWNED);
 }
 
 void VFile_Close(VFILE *file)
 {
     ASSERT(file != nullptr);
-    Memory_FreePointer(&file->content);
+    switch (file->storage) {
+    case VFILE_STORAGE_OWNED:
+        Memory_FreePointer(&file->content);
+        break;
+    case VFILE_STORAGE_MAPPED:
+#if !defined(_WIN32)
+        munmap((void *)file->content, file->size);
+#endif
+        break;
+    }
     Memory_FreePointer(&file);
 }
 
@@ -15,6 +15,7 @@
 #include "game/spawn.h"
 #include "global/vars.h"
 
+#include <libtrx/game/item_grid.h>
 #include <libtrx/game/math.h>
 #include <libtrx/log.h>
 
@@ -337,16 +338,20 @@ bool Creature_CheckBaddieOverlap(int16_t item_num)
     int32_t x = item->pos.x;
     int32_t y = item->pos.y;
     int32_t z = item->pos.z;
-    const int32_t radius = SQUARE(Object_Get(item->object_id)->radius);
-
-    int16_t link = Room_Get(item->room_num)->item_num;
-    do {
-        item = Item_Get(link);
-
+    const int32_t obj_radius = Object_Get(item->object_id)->radius;
+    const int32_t radius = SQUARE(obj_radius);
+
+    // Only items that come before this one in the room list are considered,
+    // so that of two overlapping creatures only one of them gets blocked.
+    const int16_t *const nearby =
+        ItemGrid_GetNearbyItems(item->room_num, x, z, obj_radius);
+    for (int32_t i = 0; nearby[i] != NO_ITEM; i++) {
+        const int16_t link = nearby[i];
         if (link == item_num) {
             return false;
         }
 
+        item = Item_Get(link);
         if (item != g_LaraItem && item->status == IS_ACTIVE
             && item->speed != 0) {
             int32_t distance = SQUARE(item->pos.x - x) + SQUARE(item->pos.y - y)
@@ -355,9 +360,7 @@ bool Creature_CheckBaddieOverlap(int16_t item_num)
                 return true;
             }
         }
-
-        link = item->next_item;
-    } while (link != NO_ITEM);
+    }
 
     return false;
 }
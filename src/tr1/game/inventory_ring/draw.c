@@ -17,6 +17,7 @@
 #include <libtrx/config.h>
 #include <libtrx/game/inventory_ring/priv.h>
 #include <libtrx/game/matrix.h>
+#include <libtrx/utils.h>
 
 static int32_t M_GetFrames(
     const INV_RING *ring, const INVENTORY_ITEM *inv_item,
@@ -55,7 +56,7 @@ static int32_t M_GetFrames(
     *out_frame1 = &obj->frame_base[cur_frame_num];
     *out_frame2 = &obj->frame_base[next_frame_num];
     *out_rate = 10;
-    return (Interpolation_GetRate() - 0.5) * 10.0;
+    return MAX(Interpolation_GetRate() - 0.5, 0.0) * 10.0;
 
     // OG
 fallback:
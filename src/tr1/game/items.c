@@ -12,6 +12,7 @@
 #include "global/vars.h"
 
 #include <libtrx/config.h>
+#include <libtrx/game/item_grid.h>
 #include <libtrx/game/math.h>
 #include <libtrx/game/matrix.h>
 #include <libtrx/utils.h>
@@ -31,6 +32,8 @@ static BOUNDS_16 m_InterpolatedBounds = {};
 
 void Item_Control(void)
 {
+    ItemGrid_Sync();
+
     int16_t item_num = Item_GetNextActive();
     while (item_num != NO_ITEM) {
         ITEM *item = Item_Get(item_num);
@@ -87,6 +90,7 @@ void Item_Initialise(int16_t item_num)
     ROOM *const room = Room_Get(item->room_num);
     item->next_item = room->item_num;
     room->item_num = item_num;
+    ItemGrid_Link(item_num);
     const SECTOR *const sector =
         Room_GetWorldSector(room, item->pos.x, item->pos.z);
     item->floor = sector->floor.height;
@@ -480,7 +484,9 @@ int32_t Item_GetFrames(const ITEM *item, ANIM_FRAME *frmptr[], int32_t *rate)
         (key_frame_shift + clock_ratio) / (double)key_frame_span;
     const double interp_frame_num =
         (first_key_frame_num * key_frame_span) + (final * key_frame_span);
-    if (interp_frame_num >= last_frame_num) {
+    // Above 60 FPS the first frames of a tick would land before the first
+    // key frame.
+    if (final < 0.0 || interp_frame_num >= last_frame_num) {
         *rate = denominator;
         return numerator;
     }
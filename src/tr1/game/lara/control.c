@@ -18,6 +18,7 @@
 #include "global/vars.h"
 
 #include <libtrx/config.h>
+#include <libtrx/game/item_grid.h>
 #include <libtrx/game/math.h>
 
 #include <stdint.h>
@@ -119,8 +120,10 @@ static void M_BaddieCollision(ITEM *lara_item, COLL_INFO *coll)
         Room_GetAdjoiningRooms(lara_item->room_num, roomies, 12);
 
     for (int32_t i = 0; i < roomies_count; i++) {
-        int16_t item_num = Room_Get(roomies[i])->item_num;
-        while (item_num != NO_ITEM) {
+        const int16_t *const nearby = ItemGrid_GetNearbyItems(
+            roomies[i], lara_item->pos.x, lara_item->pos.z, TARGET_DIST);
+        for (int32_t j = 0; nearby[j] != NO_ITEM; j++) {
+            const int16_t item_num = nearby[j];
             const ITEM *const item = Item_Get(item_num);
             if (item->collidable && item->status != IS_INVISIBLE) {
                 const OBJECT *const obj = Object_Get(item->object_id);
@@ -135,7 +138,6 @@ static void M_BaddieCollision(ITEM *lara_item, COLL_INFO *coll)
                     }
                 }
             }
-            item_num = item->next_item;
         }
     }
 
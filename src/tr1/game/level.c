@@ -38,9 +38,18 @@
 #include <libtrx/utils.h>
 #include <libtrx/virtual_file.h>
 
+#include <SDL2/SDL_atomic.h>
+#include <SDL2/SDL_events.h>
+#include <SDL2/SDL_thread.h>
+#include <SDL2/SDL_timer.h>
 #include <stdio.h>
 #include <string.h>
 
+#define LOAD_PROGRESS_SCALE 1000
+#define LOAD_PROGRESS_CPU_END 0.8f
+#define LOAD_FRAME_DELAY_MS 15
+#define UPLOAD_SLICE_MS 8
+
 typedef enum {
     LEVEL_LAYOUT_UNKNOWN = -1,
     LEVEL_LAYOUT_TR1,
@@ -48,12 +57,26 @@ typedef enum {
     LEVEL_LAYOUT_NUMBER_OF,
 } LEVEL_LAYOUT;
 
+// Parts of the file that are not read in file order.
+typedef enum {
+    LEVEL_SECTION_TEXTURE_PAGES,
+    LEVEL_SECTION_PALETTE,
+    LEVEL_SECTION_CAMERAS,
+    LEVEL_SECTION_CINEMATIC_FRAMES,
+    LEVEL_SECTION_NUMBER_OF,
+} LEVEL_SECTION;
+
 static LEVEL_INFO m_LevelInfo = {};
+static SDL_atomic_t m_LoadProgress;
+static SDL_atomic_t m_LoaderDone;
 static INJECTION_INFO *m_InjectionInfo = nullptr;
+static char m_LoaderError[256] = {};
 
-static bool M_TryLayout(VFILE *file, LEVEL_LAYOUT layout);
-static LEVEL_LAYOUT M_GuessLayout(VFILE *file);
-static void M_LoadFromFile(const GF_LEVEL *level);
+static bool M_ScanCommonSections(VFILE *file, size_t *sections);
+static bool M_ScanLayoutSections(
+    VFILE *file, LEVEL_LAYOUT layout, size_t *sections);
+static LEVEL_LAYOUT M_ScanSections(VFILE *file, size_t *sections);
+static bool M_LoadFromFile(const GF_LEVEL *level);
 static void M_LoadObjectMeshes(VFILE *file);
 static void M_LoadAnims(VFILE *file);
 static void M_LoadAnimChanges(VFILE *file);
@@ -66,9 +89,12 @@ static void M_LoadSprites(VFILE *file);
 static void M_CompleteSetup(const GF_LEVEL *level);
 static void M_MarkWaterEdgeVertices(void);
 static size_t M_CalculateMaxVertices(void);
+static void M_SetLoadProgress(float progress);
+static float M_GetLoadProgress(void);
+static int M_LoaderThread(void *arg);
+static void M_RunLoader(const GF_LEVEL *level);
+static void M_UploadTextures(void);
 
-static bool M_TryLayout(VFILE *const file, const LEVEL_LAYOUT layout)
-{
 #define TRY_OR_FAIL(call)                                                      \
     if (!call) {                                                               \
         return false;                                                          \
@@ -86,6 +112,8 @@ static bool M_TryLayout(VFILE *const file, const LEVEL_LAYOUT layout)
         TRY_OR_FAIL(VFile_TrySkip(file, num *size));                           \
     }
 
+static bool M_ScanCommonSections(VFILE *const file, size_t *const sections)
+{
     VFile_SetPos(file, 0);
 
     int32_t version;
@@ -96,6 +124,7 @@ static bool M_TryLayout(VFILE *const file, const LEVEL_LAYOUT layout)
         return false;
     }
 
+    sections[LEVEL_SECTION_TEXTURE_PAGES] = VFile_GetPos(file);
     TRY_OR_FAIL_ARR_S32(TEXTURE_PAGE_SIZE); // textures
     TRY_OR_FAIL(VFile_TrySkip(file, 4));
 
@@ -132,11 +161,18 @@ static bool M_TryLayout(VFILE *const file, const LEVEL_LAYOUT layout)
     TRY_OR_FAIL_ARR_S32(20); // textures
     TRY_OR_FAIL_ARR_S32(16); // sprites
     TRY_OR_FAIL_ARR_S32(8); // sprites sequences
+    return true;
+}
 
+static bool M_ScanLayoutSections(
+    VFILE *const file, const LEVEL_LAYOUT layout, size_t *const sections)
+{
     if (layout == LEVEL_LAYOUT_TR1_DEMO_PC) {
+        sections[LEVEL_SECTION_PALETTE] = VFile_GetPos(file);
         TRY_OR_FAIL(VFile_TrySkip(file, 768)); // palette
     }
 
+    sections[LEVEL_SECTION_CAMERAS] = VFile_GetPos(file);
     TRY_OR_FAIL_ARR_S32(16); // cameras
     TRY_OR_FAIL_ARR_S32(16); // sound effects
 
@@ -152,9 +188,11 @@ static bool M_TryLayout(VFILE *const file, const LEVEL_LAYOUT layout)
     TRY_OR_FAIL(VFile_TrySkip(file, 32 * 256)); // light table
 
     if (layout != LEVEL_LAYOUT_TR1_DEMO_PC) {
+        sections[LEVEL_SECTION_PALETTE] = VFile_GetPos(file);
         TRY_OR_FAIL(VFile_TrySkip(file, 768)); // palette
     }
 
+    sections[LEVEL_SECTION_CINEMATIC_FRAMES] = VFile_GetPos(file);
     TRY_OR_FAIL_ARR_U16(16); // cinematic frames
     TRY_OR_FAIL_ARR_U16(1); // demo data
 
@@ -162,52 +200,69 @@ static bool M_TryLayout(VFILE *const file, const LEVEL_LAYOUT layout)
     TRY_OR_FAIL_ARR_S32(8); // sample infos
     TRY_OR_FAIL_ARR_S32(1); // sample data
     TRY_OR_FAIL_ARR_S32(4); // samples
+    return true;
+}
 
 #undef TRY_OR_FAIL
 #undef TRY_OR_FAIL_ARR_U16
 #undef TRY_OR_FAIL_ARR_S32
-    return true;
-}
 
-static LEVEL_LAYOUT M_GuessLayout(VFILE *const file)
+static LEVEL_LAYOUT M_ScanSections(VFILE *const file, size_t *const sections)
 {
+    // All known layouts share everything up to the sprite sequences and only
+    // disagree on where the palette goes, so the common part is validated
+    // once and only the remainder is tried for each layout.
     LEVEL_LAYOUT result = LEVEL_LAYOUT_UNKNOWN;
     BENCHMARK *const benchmark = Benchmark_Start();
-    for (LEVEL_LAYOUT layout = 0; layout < LEVEL_LAYOUT_NUMBER_OF; layout++) {
-        if (M_TryLayout(file, layout)) {
-            result = layout;
-            break;
+    if (M_ScanCommonSections(file, sections)) {
+        const size_t branch_pos = VFile_GetPos(file);
+        for (LEVEL_LAYOUT layout = 0; layout < LEVEL_LAYOUT_NUMBER_OF;
+             layout++) {
+            VFile_SetPos(file, branch_pos);
+            if (M_ScanLayoutSections(file, layout, sections)) {
+                result = layout;
+                break;
+            }
         }
     }
     Benchmark_End(benchmark, nullptr);
     return result;
 }
 
-static void M_LoadFromFile(const GF_LEVEL *const level)
+static bool M_LoadFromFile(const GF_LEVEL *const level)
 {
     GameBuf_Reset();
 
     VFILE *file = VFile_CreateFromPath(level->path);
     if (!file) {
-        Shell_ExitSystemFmt("Could not open %s", level->path);
+        snprintf(
+            m_LoaderError, sizeof(m_LoaderError), "Could not open %s",
+            level->path);
+        return false;
     }
 
-    const LEVEL_LAYOUT layout = M_GuessLayout(file);
+    size_t sections[LEVEL_SECTION_NUMBER_OF];
+    const LEVEL_LAYOUT layout = M_ScanSections(file, sections);
     if (layout == LEVEL_LAYOUT_UNKNOWN) {
-        Shell_ExitSystemFmt("Failed to load %s", level->path);
+        snprintf(
+            m_LoaderError, sizeof(m_LoaderError), "Failed to load %s",
+            level->path);
+        VFile_Close(file);
+        return false;
     }
-    VFile_SetPos(file, 4);
 
-    {
-        // Read texture pages once the palette is available.
-        const int32_t num_pages = VFile_ReadS32(file);
-        VFile_Skip(file, num_pages * TEXTURE_PAGE_SIZE * sizeof(uint8_t));
-    }
+    // Texture pages come first in the file, but they need the palette.
+    VFile_SetPos(file, sections[LEVEL_SECTION_PALETTE]);
+    Level_ReadPalettes(&m_LevelInfo, file);
+    VFile_SetPos(file, sections[LEVEL_SECTION_TEXTURE_PAGES]);
+    Level_ReadTexturePages(
+        &m_LevelInfo, m_InjectionInfo->texture_page_count, file);
 
     const int32_t file_level_num = VFile_ReadS32(file);
     LOG_INFO("file level num: %d", file_level_num);
 
     Level_ReadRooms(file);
+    M_SetLoadProgress(0.2f);
     M_LoadObjectMeshes(file);
     M_LoadAnims(file);
     M_LoadAnimChanges(file);
@@ -220,11 +275,9 @@ static void M_LoadFromFile(const GF_LEVEL *const level)
     M_LoadTextures(file);
     M_LoadSprites(file);
     Level_ReadSpriteSequences(file);
+    M_SetLoadProgress(0.4f);
 
-    if (layout == LEVEL_LAYOUT_TR1_DEMO_PC) {
-        Level_ReadPalettes(&m_LevelInfo, file);
-    }
-
+    VFile_SetPos(file, sections[LEVEL_SECTION_CAMERAS]);
     Level_ReadCamerasAndSinks(file);
     Level_ReadSoundSources(file);
     Level_ReadPathingData(file);
@@ -233,21 +286,16 @@ static void M_LoadFromFile(const GF_LEVEL *const level)
     Stats_ObserveItemsLoad();
     Level_ReadLightMap(file);
 
-    if (layout != LEVEL_LAYOUT_TR1_DEMO_PC) {
-        Level_ReadPalettes(&m_LevelInfo, file);
-    }
-
+    VFile_SetPos(file, sections[LEVEL_SECTION_CINEMATIC_FRAMES]);
     Level_ReadCinematicFrames(file);
     Level_ReadDemoData(file);
     Level_ReadSamples(
         &m_LevelInfo, m_InjectionInfo->sfx_count,
         m_InjectionInfo->sfx_data_size, m_InjectionInfo->sample_count, file);
-
-    VFile_SetPos(file, 4);
-    Level_ReadTexturePages(
-        &m_LevelInfo, m_InjectionInfo->texture_page_count, file);
+    M_SetLoadProgress(0.5f);
 
     VFile_Close(file);
+    return true;
 }
 
 static void M_LoadObjectMeshes(VFILE *const file)
@@ -383,9 +431,12 @@ static void M_CompleteSetup(const GF_LEVEL *const level)
     Mutant_ToggleExplosions(Object_Get(O_EXPLOSION_1)->loaded);
 
     Inject_AllInjections(&m_LevelInfo);
+    M_SetLoadProgress(0.6f);
+    Benchmark_Tick(benchmark, "injections");
 
     Level_LoadAnimFrames(&m_LevelInfo);
     Level_LoadAnimCommands();
+    Benchmark_Tick(benchmark, "animations");
 
     M_MarkWaterEdgeVertices();
 
@@ -393,19 +444,23 @@ static void M_CompleteSetup(const GF_LEVEL *const level)
     Stats_ObserveRoomsLoad();
 
     Level_LoadObjectsAndItems();
+    M_SetLoadProgress(0.7f);
 
     Lara_State_Initialise();
 
     // Configure enemies who carry and drop items
     Carrier_InitialiseLevel(level);
+    Benchmark_Tick(benchmark, "objects and items");
 
     const size_t max_vertices = M_CalculateMaxVertices();
     LOG_INFO("Maximum vertices: %d", max_vertices);
     Output_ReserveVertexBuffer(max_vertices);
 
+    // Uploading the texture pages to the GPU is deferred to the main thread;
+    // see M_UploadTextures.
     Level_LoadTexturePages(&m_LevelInfo);
     Level_LoadPalettes(&m_LevelInfo);
-    Output_DownloadTextures(m_LevelInfo.textures.page_count);
+    Benchmark_Tick(benchmark, "textures and palettes");
 
     // Initialise the sound effects.
     const int32_t sample_count = m_LevelInfo.samples.offset_count;
@@ -431,7 +486,7 @@ static void M_CompleteSetup(const GF_LEVEL *const level)
     Memory_FreePointer(&sample_sizes);
     Memory_FreePointer(&m_LevelInfo.samples.offsets);
 
-    Benchmark_End(benchmark, nullptr);
+    Benchmark_End(benchmark, "sound effects");
 }
 
 static void M_MarkWaterEdgeVertices(void)
@@ -491,17 +546,94 @@ static size_t M_CalculateMaxVertices(void)
     return max_vertices;
 }
 
+static void M_SetLoadProgress(const float progress)
+{
+    SDL_AtomicSet(&m_LoadProgress, progress * LOAD_PROGRESS_SCALE);
+}
+
+static float M_GetLoadProgress(void)
+{
+    return SDL_AtomicGet(&m_LoadProgress) / (float)LOAD_PROGRESS_SCALE;
+}
+
+static int M_LoaderThread(void *const arg)
+{
+    // Everything in here must stay clear of the GL context, the per-frame
+    // scratch arena and the regex cache, all of which are owned by the main
+    // thread. The latter two assert on it. For the same reason fatal errors
+    // are only recorded here and raised by M_RunLoader, since exiting tears
+    // down the window.
+    const GF_LEVEL *const level = arg;
+    Inject_Init(
+        level->injections.count, level->injections.data_paths, m_InjectionInfo);
+    const bool result = M_LoadFromFile(level);
+    if (result) {
+        M_CompleteSetup(level);
+        M_SetLoadProgress(LOAD_PROGRESS_CPU_END);
+    }
+    SDL_AtomicSet(&m_LoaderDone, 1);
+    return result ? 0 : 1;
+}
+
+static void M_RunLoader(const GF_LEVEL *const level)
+{
+    M_SetLoadProgress(0.0f);
+    SDL_AtomicSet(&m_LoaderDone, 0);
+    m_LoaderError[0] = '\0';
+
+    SDL_Thread *const thread =
+        SDL_CreateThread(M_LoaderThread, "level_loader", (void *)level);
+    if (thread == nullptr) {
+        LOG_ERROR("SDL_CreateThread(): %s", SDL_GetError());
+        M_LoaderThread((void *)level);
+    } else {
+        // Keep the window responsive while the level is parsed. Events are
+        // only pumped and not processed, as the handlers may reach into level
+        // data.
+        while (!SDL_AtomicGet(&m_LoaderDone)) {
+            SDL_PumpEvents();
+            Output_DrawLoadingProgress(M_GetLoadProgress());
+            SDL_Delay(LOAD_FRAME_DELAY_MS);
+        }
+        SDL_WaitThread(thread, nullptr);
+    }
+
+    if (m_LoaderError[0] != '\0') {
+        Shell_ExitSystem(m_LoaderError);
+    }
+}
+
+static void M_UploadTextures(void)
+{
+    BENCHMARK *const benchmark = Benchmark_Start();
+    const int32_t page_count = m_LevelInfo.textures.page_count;
+    Output_BeginTextureDownload(page_count);
+
+    Uint32 slice_start = SDL_GetTicks();
+    for (int32_t i = 0; i < page_count; i++) {
+        Output_DownloadTexturePage(i);
+        if (SDL_GetTicks() - slice_start >= UPLOAD_SLICE_MS) {
+            SDL_PumpEvents();
+            Output_DrawLoadingProgress(
+                LOAD_PROGRESS_CPU_END
+                + (1.0f - LOAD_PROGRESS_CPU_END) * (i + 1) / page_count);
+            slice_start = SDL_GetTicks();
+        }
+    }
+
+    Output_EndTextureDownload();
+    Benchmark_End(benchmark, nullptr);
+}
+
 void Level_Load(const GF_LEVEL *const level)
 {
     LOG_INFO("%d (%s)", level->num, level->path);
     BENCHMARK *const benchmark = Benchmark_Start();
+    const size_t peak_rss = Benchmark_GetPeakRSS();
 
     m_InjectionInfo = Memory_Alloc(sizeof(INJECTION_INFO));
-    Inject_Init(
-        level->injections.count, level->injections.data_paths, m_InjectionInfo);
-
-    M_LoadFromFile(level);
-    M_CompleteSetup(level);
+    M_RunLoader(level);
+    M_UploadTextures();
 
     Inject_Cleanup();
     Memory_FreePointer(&m_InjectionInfo);
@@ -512,6 +644,9 @@ void Level_Load(const GF_LEVEL *const level)
     Output_SetSkyboxEnabled(
         g_Config.visuals.enable_skybox && Object_Get(O_SKYBOX)->loaded);
 
+    LOG_DEBUG(
+        "peak RSS: %zu KiB before, %zu KiB after", peak_rss / 1024,
+        Benchmark_GetPeakRSS() / 1024);
     Benchmark_End(benchmark, nullptr);
 }
 
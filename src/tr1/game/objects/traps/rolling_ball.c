@@ -10,6 +10,7 @@
 #include "global/vars.h"
 
 #include <libtrx/game/game_buf.h>
+#include <libtrx/game/item_grid.h>
 #include <libtrx/game/math.h>
 #include <libtrx/utils.h>
 
@@ -102,6 +103,7 @@ static void M_Control(const int16_t item_num)
             item->next_item = room->item_num;
             room->item_num = item_num;
             item->room_num = data->room_num;
+            ItemGrid_Link(item_num);
         }
         item->current_anim_state = TRAP_SET;
         item->goal_anim_state = TRAP_SET;
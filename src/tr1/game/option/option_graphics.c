@@ -24,6 +24,7 @@
 #define LEFT_ARROW_OFFSET (-20)
 #define RIGHT_ARROW_OFFSET_MIN 35
 #define RIGHT_ARROW_OFFSET_MAX 85
+#define FPS_PRESET_COUNT 6
 
 typedef enum {
     TEXT_TITLE,
@@ -94,6 +95,10 @@ static const GRAPHICS_OPTION_ROW m_GfxOptionRows[] = {
 
 static GRAPHICS_MENU m_GraphicsMenu = {};
 
+static const int32_t m_FPSPresets[FPS_PRESET_COUNT] = {
+    30, 60, 120, 144, 165, 240,
+};
+
 static bool m_IsTextInit = false;
 static bool m_HideArrowLeft = false;
 static bool m_HideArrowRight = false;
@@ -113,6 +118,28 @@ static void M_ChangeTextOption(
     const GRAPHICS_OPTION_ROW *row, TEXTSTRING *option_text,
     TEXTSTRING *value_text);
 static int16_t M_PlaceColumns(bool create);
+static int32_t M_GetPrevFPS(int32_t fps);
+static int32_t M_GetNextFPS(int32_t fps);
+
+static int32_t M_GetPrevFPS(const int32_t fps)
+{
+    for (int32_t i = FPS_PRESET_COUNT - 1; i >= 0; i--) {
+        if (m_FPSPresets[i] < fps) {
+            return m_FPSPresets[i];
+        }
+    }
+    return fps;
+}
+
+static int32_t M_GetNextFPS(const int32_t fps)
+{
+    for (int32_t i = 0; i < FPS_PRESET_COUNT; i++) {
+        if (m_FPSPresets[i] > fps) {
+            return m_FPSPresets[i];
+        }
+    }
+    return fps;
+}
 
 static void M_InitMenu(void)
 {
@@ -265,8 +292,10 @@ static void M_UpdateArrows(
 
     switch (option_name) {
     case OPTION_FPS:
-        m_HideArrowLeft = g_Config.rendering.fps == 30;
-        m_HideArrowRight = g_Config.rendering.fps == 60;
+        m_HideArrowLeft =
+            M_GetPrevFPS(g_Config.rendering.fps) == g_Config.rendering.fps;
+        m_HideArrowRight =
+            M_GetNextFPS(g_Config.rendering.fps) == g_Config.rendering.fps;
         break;
     case OPTION_TEXTURE_FILTER:
         m_HideArrowLeft = g_Config.rendering.texture_filter == GFX_TF_FIRST;
@@ -501,7 +530,7 @@ void Option_Graphics_Control(INVENTORY_ITEM *inv_item, const bool is_busy)
     if (g_InputDB.menu_right) {
         switch (m_GraphicsMenu.cur_option->option_name) {
         case OPTION_FPS:
-            g_Config.rendering.fps = 60;
+            g_Config.rendering.fps = M_GetNextFPS(g_Config.rendering.fps);
             reset = OPTION_FPS;
             break;
 
@@ -600,7 +629,7 @@ void Option_Graphics_Control(INVENTORY_ITEM *inv_item, const bool is_busy)
     if (g_InputDB.menu_left) {
         switch (m_GraphicsMenu.cur_option->option_name) {
         case OPTION_FPS:
-            g_Config.rendering.fps = 30;
+            g_Config.rendering.fps = M_GetPrevFPS(g_Config.rendering.fps);
             reset = OPTION_FPS;
             break;
 
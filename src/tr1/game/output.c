@@ -27,6 +27,10 @@
 
 #define MAX_LIGHTNINGS 64
 #define PHD_IONE (PHD_ONE / 4)
+#define LOADING_BAR_BORDER_COLOR ((RGBA_8888) { 128, 128, 128, 255 })
+#define LOADING_BAR_BGND_COLOR ((RGBA_8888) { 0, 0, 0, 255 })
+#define LOADING_BAR_FILL_COLOR ((RGBA_8888) { 255, 128, 0, 255 })
+#define SCREEN_SPRITE_BATCH_SIZE 64
 
 typedef struct {
     struct {
@@ -534,6 +538,49 @@ void Output_DownloadTextures(int page_count)
     S_Output_DownloadTextures(page_count);
 }
 
+void Output_BeginTextureDownload(const int32_t page_count)
+{
+    S_Output_BeginTextureDownload(page_count);
+}
+
+void Output_DownloadTexturePage(const int32_t page)
+{
+    S_Output_DownloadTexturePage(page);
+}
+
+void Output_EndTextureDownload(void)
+{
+    S_Output_EndTextureDownload();
+}
+
+void Output_DrawLoadingProgress(float progress)
+{
+    CLAMP(progress, 0.0f, 1.0f);
+    const int32_t width = Viewport_GetWidth();
+    const int32_t height = Viewport_GetHeight();
+    const int32_t border = MAX(1, height / 240);
+    const int32_t bar_w = width / 2;
+    const int32_t bar_h = MAX(4, height / 60);
+    const int32_t sx = (width - bar_w) / 2;
+    const int32_t sy = height - bar_h * 4;
+
+    S_Output_RenderBegin();
+    S_Output_Draw2DQuad(
+        sx - border, sy - border, sx + bar_w + border, sy + bar_h + border,
+        LOADING_BAR_BORDER_COLOR, LOADING_BAR_BORDER_COLOR,
+        LOADING_BAR_BORDER_COLOR, LOADING_BAR_BORDER_COLOR);
+    S_Output_Draw2DQuad(
+        sx, sy, sx + bar_w, sy + bar_h, LOADING_BAR_BGND_COLOR,
+        LOADING_BAR_BGND_COLOR, LOADING_BAR_BGND_COLOR,
+        LOADING_BAR_BGND_COLOR);
+    S_Output_Draw2DQuad(
+        sx, sy, sx + bar_w * progress, sy + bar_h, LOADING_BAR_FILL_COLOR,
+        LOADING_BAR_FILL_COLOR, LOADING_BAR_FILL_COLOR,
+        LOADING_BAR_FILL_COLOR);
+    S_Output_RenderEnd();
+    S_Output_FlipScreen();
+}
+
 void Output_DrawBlack(void)
 {
     Output_DrawBlackRectangle(255);
@@ -993,6 +1040,41 @@ void Output_DrawScreenSprite(
     }
 }
 
+void Output_DrawScreenSprites(
+    const TEXT_GLYPH_SPRITE *const sprites, const int32_t count,
+    const int32_t scale_h, const int32_t scale_v)
+{
+    const int32_t z = Output_GetNearZ() + 200;
+    S_OUTPUT_SPRITE batch[SCREEN_SPRITE_BATCH_SIZE];
+    int32_t batch_count = 0;
+    for (int32_t i = 0; i < count; i++) {
+        const TEXT_GLYPH_SPRITE *const glyph = &sprites[i];
+        const SPRITE_TEXTURE *const sprite =
+            Output_GetSpriteTexture(glyph->sprite_num);
+        const int32_t x0 = glyph->x + (scale_h * sprite->x0 / PHD_ONE);
+        const int32_t x1 = glyph->x + (scale_h * sprite->x1 / PHD_ONE);
+        const int32_t y0 = glyph->y + (scale_v * sprite->y0 / PHD_ONE);
+        const int32_t y1 = glyph->y + (scale_v * sprite->y1 / PHD_ONE);
+        if (x1 < 0 || y1 < 0 || x0 >= Viewport_GetWidth()
+            || y0 >= Viewport_GetHeight()) {
+            continue;
+        }
+
+        batch[batch_count++] = (S_OUTPUT_SPRITE) {
+            .x0 = x0,
+            .y0 = y0,
+            .x1 = x1,
+            .y1 = y1,
+            .sprite_num = glyph->sprite_num,
+        };
+        if (batch_count == SCREEN_SPRITE_BATCH_SIZE) {
+            S_Output_DrawSprites(batch, batch_count, z, 0);
+            batch_count = 0;
+        }
+    }
+    S_Output_DrawSprites(batch, batch_count, z, 0);
+}
+
 void Output_DrawSpriteRel(
     int32_t x, int32_t y, int32_t z, int16_t sprnum, int16_t shade)
 {
@@ -15,6 +15,16 @@ void Output_SetWindowSize(int width, int height);
 void Output_ApplyRenderSettings(void);
 void Output_DownloadTextures(int page_count);
 
+// Staged variant of Output_DownloadTextures, allowing the caller to present
+// frames in between the individual page uploads.
+void Output_BeginTextureDownload(int32_t page_count);
+void Output_DownloadTexturePage(int32_t page);
+void Output_EndTextureDownload(void);
+
+// Presents a bare progress bar frame. Does not touch any level resources, so
+// it is safe to call while the level is being loaded on another thread.
+void Output_DrawLoadingProgress(float progress);
+
 int32_t Output_GetNearZ(void);
 int32_t Output_GetFarZ(void);
 int32_t Output_GetDrawDistMin(void);
@@ -71,6 +81,10 @@ void Output_DrawSprite(
 void Output_DrawScreenSprite(
     int32_t sx, int32_t sy, int32_t z, int32_t scale_h, int32_t scale_v,
     int32_t sprnum, int16_t shade, uint16_t flags, int32_t page);
+// Draws pre-positioned glyph sprites that share the same scale in one go.
+void Output_DrawScreenSprites(
+    const TEXT_GLYPH_SPRITE *sprites, int32_t count, int32_t scale_h,
+    int32_t scale_v);
 void Output_DrawSpriteRel(
     int32_t x, int32_t y, int32_t z, int16_t sprnum, int16_t shade);
 void Output_DrawUISprite(
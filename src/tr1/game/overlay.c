@@ -651,15 +651,18 @@ static void M_DrawAmmoInfo(void)
         Text_AlignRight(m_AmmoText, 1);
     }
 
-    m_AmmoText->pos.x = m_BarOffsetY[BL_TOP_RIGHT]
+    const int32_t ammo_x = m_BarOffsetY[BL_TOP_RIGHT]
         ? (-screen_margin_h * scale_ammo_to_bar) - text_offset_x
         : -screen_margin_h - text_offset_x;
 
-    m_AmmoText->pos.y = m_BarOffsetY[BL_TOP_RIGHT]
+    const int32_t ammo_y = m_BarOffsetY[BL_TOP_RIGHT]
         ? text_height + (screen_margin_v * scale_ammo_to_bar)
             + (m_BarOffsetY[BL_TOP_RIGHT] * scale_ammo_to_bar)
         : text_height + screen_margin_v;
 
+    // Go through the setter so that the cached glyph layout gets refreshed.
+    Text_SetPos(m_AmmoText, ammo_x, ammo_y);
+
     if (m_AmmoText) {
         Text_DrawText(m_AmmoText);
     }
@@ -43,6 +43,13 @@ typedef struct {
         bool restart;
         bool select_level;
     } features;
+    // Identifies the file version the info above was read from, so that
+    // rescans only need to parse files that changed on the disk.
+    struct {
+        bool is_known;
+        size_t size;
+        int64_t mtime;
+    } stamp;
 } SAVEGAME_INFO;
 
 void Savegame_Init(void);
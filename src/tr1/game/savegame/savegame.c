@@ -15,6 +15,7 @@
 #include "global/types.h"
 #include "global/vars.h"
 
+#include <libtrx/benchmark.h>
 #include <libtrx/config.h>
 #include <libtrx/debug.h>
 #include <libtrx/enum_map.h>
@@ -35,8 +36,10 @@ typedef struct {
     bool (*fill_info)(MYFILE *fp, SAVEGAME_INFO *info);
     bool (*load_from_file)(MYFILE *fp, GAME_INFO *game_info);
     bool (*load_only_resume_info)(MYFILE *fp, GAME_INFO *game_info);
-    void (*save_to_file)(MYFILE *fp, GAME_INFO *game_info);
-    bool (*update_death_counters)(MYFILE *fp, GAME_INFO *game_info);
+    void (*save_to_file)(
+        int32_t slot_num, const char *path, GAME_INFO *game_info);
+    bool (*update_death_counters)(
+        int32_t slot_num, const char *path, GAME_INFO *game_info);
 } SAVEGAME_STRATEGY;
 
 static int32_t m_SaveSlots = 0;
@@ -69,10 +72,34 @@ static const SAVEGAME_STRATEGY m_Strategies[] = {
     { 0 },
 };
 
+static void M_ClearSlot(SAVEGAME_INFO *savegame_info);
 static void M_Clear(void);
+static void M_RefreshSlots(void);
+static char *M_FindSaveFile(
+    const char *filename, const FILE_LISTING *saves_listing,
+    const FILE_LISTING *game_listing, const FILE_ENTRY **out_entry);
+static bool M_CheckCache(
+    SAVEGAME_INFO *savegame_info, const SAVEGAME_STRATEGY *strategy,
+    const char *path, const FILE_ENTRY *entry);
+static bool M_ReadSlot(
+    SAVEGAME_INFO *savegame_info, const SAVEGAME_STRATEGY *strategy,
+    const char *path, const FILE_ENTRY *entry);
+static void M_ScanSlot(
+    int32_t slot_num, const FILE_LISTING *saves_listing,
+    const FILE_LISTING *game_listing);
 static void M_LoadPreprocess(void);
 static void M_LoadPostprocess(void);
 
+static void M_ClearSlot(SAVEGAME_INFO *const savegame_info)
+{
+    savegame_info->format = 0;
+    savegame_info->counter = -1;
+    savegame_info->level_num = -1;
+    savegame_info->stamp.is_known = false;
+    Memory_FreePointer(&savegame_info->full_path);
+    Memory_FreePointer(&savegame_info->level_title);
+}
+
 static void M_Clear(void)
 {
     if (m_SavegameInfo == nullptr) {
@@ -80,15 +107,179 @@ static void M_Clear(void)
     }
 
     for (int i = 0; i < m_SaveSlots; i++) {
-        SAVEGAME_INFO *const savegame_info = &m_SavegameInfo[i];
-        savegame_info->format = 0;
-        savegame_info->counter = -1;
-        savegame_info->level_num = -1;
-        Memory_FreePointer(&savegame_info->full_path);
-        Memory_FreePointer(&savegame_info->level_title);
+        M_ClearSlot(&m_SavegameInfo[i]);
     }
 }
 
+static void M_RefreshSlots(void)
+{
+    g_SaveCounter = 0;
+    g_SavedGamesCount = 0;
+    for (int i = 0; i < m_SaveSlots; i++) {
+        const SAVEGAME_INFO *const savegame_info = &m_SavegameInfo[i];
+        if (savegame_info->level_title) {
+            if (savegame_info->counter > g_SaveCounter) {
+                g_SaveCounter = savegame_info->counter;
+            }
+            g_SavedGamesCount++;
+        }
+    }
+
+    REQUEST_INFO *req = &g_SavegameRequester;
+    Requester_ClearTextstrings(req);
+    Requester_Init(&g_SavegameRequester, Savegame_GetSlotCount());
+
+    for (int i = 0; i < req->max_items; i++) {
+        SAVEGAME_INFO *savegame_info = &m_SavegameInfo[i];
+
+        if (savegame_info->level_title) {
+            if (savegame_info->counter == g_SaveCounter) {
+                m_NewestSlot = i;
+            }
+            Requester_AddItem(
+                req, false, "%s %d", savegame_info->level_title,
+                savegame_info->counter);
+        } else {
+            Requester_AddItem(req, true, GS(MISC_EMPTY_SLOT_FMT), i + 1);
+        }
+    }
+
+    if (req->requested >= req->vis_lines) {
+        req->line_offset = req->requested - req->vis_lines + 1;
+    } else if (req->requested < req->line_offset) {
+        req->line_offset = req->requested;
+    }
+
+    g_SaveCounter++;
+}
+
+static char *M_FindSaveFile(
+    const char *const filename, const FILE_LISTING *const saves_listing,
+    const FILE_LISTING *const game_listing, const FILE_ENTRY **const out_entry)
+{
+    *out_entry = nullptr;
+
+    // Names pointing into subdirectories are not covered by the listings.
+    if (strpbrk(filename, "/\\") != nullptr) {
+        char *const path =
+            Memory_Alloc(strlen(SAVES_DIR) + strlen(filename) + 2);
+        sprintf(path, "%s/%s", SAVES_DIR, filename);
+        if (File_Exists(path)) {
+            return path;
+        }
+        Memory_Free(path);
+        return File_Exists(filename) ? Memory_DupStr(filename) : nullptr;
+    }
+
+    const FILE_ENTRY *entry = File_FindEntry(saves_listing, filename);
+    if (entry != nullptr) {
+        char *const path =
+            Memory_Alloc(strlen(SAVES_DIR) + strlen(entry->name) + 2);
+        sprintf(path, "%s/%s", SAVES_DIR, entry->name);
+        *out_entry = entry;
+        return path;
+    }
+
+    entry = File_FindEntry(game_listing, filename);
+    if (entry != nullptr) {
+        *out_entry = entry;
+        return Memory_DupStr(entry->name);
+    }
+    return nullptr;
+}
+
+static bool M_CheckCache(
+    SAVEGAME_INFO *const savegame_info,
+    const SAVEGAME_STRATEGY *const strategy, const char *const path,
+    const FILE_ENTRY *const entry)
+{
+    if (entry == nullptr || savegame_info->format != strategy->format
+        || savegame_info->full_path == nullptr
+        || strcmp(savegame_info->full_path, path) != 0) {
+        return false;
+    }
+
+    // Slots saved during this session are described from memory. The first
+    // rescan after the write has finished adopts the stamp of the new file.
+    if (!savegame_info->stamp.is_known) {
+        savegame_info->stamp.is_known = true;
+        savegame_info->stamp.size = entry->size;
+        savegame_info->stamp.mtime = entry->mtime;
+        return true;
+    }
+
+    return savegame_info->stamp.size == entry->size
+        && savegame_info->stamp.mtime == entry->mtime;
+}
+
+static bool M_ReadSlot(
+    SAVEGAME_INFO *const savegame_info,
+    const SAVEGAME_STRATEGY *const strategy, const char *const path,
+    const FILE_ENTRY *const entry)
+{
+    MYFILE *const fp = File_Open(path, FILE_OPEN_READ);
+    if (fp == nullptr) {
+        return false;
+    }
+
+    M_ClearSlot(savegame_info);
+    const bool result = strategy->fill_info(fp, savegame_info);
+    if (result) {
+        savegame_info->format = strategy->format;
+        savegame_info->full_path = Memory_DupStr(path);
+        if (entry != nullptr) {
+            savegame_info->stamp.is_known = true;
+            savegame_info->stamp.size = entry->size;
+            savegame_info->stamp.mtime = entry->mtime;
+        }
+    } else {
+        M_ClearSlot(savegame_info);
+    }
+    File_Close(fp);
+    return result;
+}
+
+static void M_ScanSlot(
+    const int32_t slot_num, const FILE_LISTING *const saves_listing,
+    const FILE_LISTING *const game_listing)
+{
+    SAVEGAME_INFO *const savegame_info = &m_SavegameInfo[slot_num];
+
+    // Slots saved during this session are described from memory, which is
+    // only right if the background write succeeded. Otherwise read back
+    // whatever is on the disk.
+    if (savegame_info->format != 0 && !savegame_info->stamp.is_known
+        && Savegame_DidWriteFail(slot_num)) {
+        M_ClearSlot(savegame_info);
+    }
+
+    const SAVEGAME_STRATEGY *strategy = &m_Strategies[0];
+    for (; strategy->format; strategy++) {
+        if (!strategy->allow_load) {
+            continue;
+        }
+
+        char *filename = strategy->get_save_filename(slot_num);
+        const FILE_ENTRY *entry = nullptr;
+        char *path =
+            M_FindSaveFile(filename, saves_listing, game_listing, &entry);
+        Memory_FreePointer(&filename);
+        if (path == nullptr) {
+            continue;
+        }
+
+        const bool is_found =
+            M_CheckCache(savegame_info, strategy, path, entry)
+            || M_ReadSlot(savegame_info, strategy, path, entry);
+        Memory_FreePointer(&path);
+        if (is_found) {
+            return;
+        }
+    }
+
+    M_ClearSlot(savegame_info);
+}
+
 static void M_LoadPreprocess(void)
 {
     Savegame_InitCurrentInfo();
@@ -174,6 +365,7 @@ RESUME_INFO *Savegame_GetCurrentInfo(const GF_LEVEL *const level)
 
 void Savegame_Shutdown(void)
 {
+    Savegame_WaitForWrites();
     M_Clear();
     Memory_FreePointer(&m_SavegameInfo);
     Memory_FreePointer(&g_GameInfo.current);
@@ -415,6 +607,7 @@ bool Savegame_Load(const int32_t slot_num)
     GAME_INFO *const game_info = &g_GameInfo;
     SAVEGAME_INFO *savegame_info = &m_SavegameInfo[slot_num];
     ASSERT(savegame_info->format != 0);
+    Savegame_WaitForSlot(slot_num);
 
     M_LoadPreprocess();
 
@@ -469,18 +662,21 @@ bool Savegame_Save(const int32_t slot_num)
                 Memory_Alloc(strlen(SAVES_DIR) + strlen(filename) + 2);
             sprintf(full_path, "%s/%s", SAVES_DIR, filename);
 
-            MYFILE *fp = File_Open(full_path, FILE_OPEN_WRITE);
-            if (fp) {
-                strategy->save_to_file(fp, game_info);
-                savegame_info->format = strategy->format;
-                Memory_FreePointer(&savegame_info->full_path);
-                savegame_info->full_path = Memory_DupStr(File_GetPath(fp));
-                savegame_info->counter = g_SaveCounter;
-                savegame_info->level_num = current_level->num;
-                File_Close(fp);
-            } else {
-                ret = false;
-            }
+            strategy->save_to_file(slot_num, full_path, game_info);
+
+            // The file is written in the background, so the slot is described
+            // from the game state rather than by reading it back.
+            M_ClearSlot(savegame_info);
+            savegame_info->format = strategy->format;
+            savegame_info->full_path = Memory_DupStr(full_path);
+            savegame_info->counter = g_SaveCounter;
+            savegame_info->level_num = current_level->num;
+            savegame_info->level_title = Memory_DupStr(current_level->title);
+            savegame_info->initial_version = game_info->save_initial_version;
+            savegame_info->features.restart =
+                game_info->save_initial_version >= VERSION_LEGACY;
+            savegame_info->features.select_level =
+                game_info->save_initial_version >= VERSION_1;
 
             Memory_FreePointer(&filename);
             Memory_FreePointer(&full_path);
@@ -488,13 +684,7 @@ bool Savegame_Save(const int32_t slot_num)
         strategy++;
     }
 
-    if (ret) {
-        REQUEST_INFO *req = &g_SavegameRequester;
-        Requester_ChangeItem(
-            req, slot_num, false, "%s %d", current_level->title, g_SaveCounter);
-    }
-
-    Savegame_ScanSavedGames();
+    M_RefreshSlots();
 
     return ret;
 }
@@ -505,21 +695,24 @@ bool Savegame_UpdateDeathCounters(int32_t slot_num, GAME_INFO *game_info)
     ASSERT(slot_num >= 0);
     SAVEGAME_INFO *savegame_info = &m_SavegameInfo[slot_num];
     ASSERT(savegame_info->format != 0);
+    Savegame_WaitForSlot(slot_num);
 
     bool ret = false;
     const SAVEGAME_STRATEGY *strategy = &m_Strategies[0];
     while (strategy->format) {
         if (savegame_info->format == strategy->format) {
-            MYFILE *fp =
-                File_Open(savegame_info->full_path, FILE_OPEN_READ_WRITE);
-            if (fp) {
-                ret = strategy->update_death_counters(fp, game_info);
-                File_Close(fp);
-            } else
-                break;
+            ret = strategy->update_death_counters(
+                slot_num, savegame_info->full_path, game_info);
+            break;
         }
         strategy++;
     }
+
+    // The file is rewritten in the background. Like after a save, the next
+    // rescan adopts the stamp of the new file.
+    if (ret) {
+        savegame_info->stamp.is_known = false;
+    }
     return ret;
 }
 
@@ -528,6 +721,7 @@ bool Savegame_LoadOnlyResumeInfo(int32_t slot_num, GAME_INFO *game_info)
     ASSERT(game_info != nullptr);
     SAVEGAME_INFO *savegame_info = &m_SavegameInfo[slot_num];
     ASSERT(savegame_info->format != 0);
+    Savegame_WaitForSlot(slot_num);
 
     bool ret = false;
     const SAVEGAME_STRATEGY *strategy = &m_Strategies[0];
@@ -550,80 +744,21 @@ bool Savegame_LoadOnlyResumeInfo(int32_t slot_num, GAME_INFO *game_info)
 
 void Savegame_ScanSavedGames(void)
 {
-    M_Clear();
-
-    g_SaveCounter = 0;
-    g_SavedGamesCount = 0;
-
-    for (int i = 0; i < m_SaveSlots; i++) {
-        SAVEGAME_INFO *savegame_info = &m_SavegameInfo[i];
-        const SAVEGAME_STRATEGY *strategy = &m_Strategies[0];
-        while (strategy->format) {
-            if (!savegame_info->format && strategy->allow_load) {
-                char *filename = strategy->get_save_filename(i);
-
-                char *full_path =
-                    Memory_Alloc(strlen(SAVES_DIR) + strlen(filename) + 2);
-                sprintf(full_path, "%s/%s", SAVES_DIR, filename);
-
-                MYFILE *fp = nullptr;
-                if (!fp) {
-                    fp = File_Open(full_path, FILE_OPEN_READ);
-                }
-                if (!fp) {
-                    fp = File_Open(filename, FILE_OPEN_READ);
-                }
-
-                if (fp) {
-                    if (strategy->fill_info(fp, savegame_info)) {
-                        savegame_info->format = strategy->format;
-                        Memory_FreePointer(&savegame_info->full_path);
-                        savegame_info->full_path =
-                            Memory_DupStr(File_GetPath(fp));
-                    }
-                    File_Close(fp);
-                }
-
-                Memory_FreePointer(&filename);
-                Memory_FreePointer(&full_path);
-            }
-            strategy++;
-        }
+    Savegame_WaitForWrites();
+    BENCHMARK *const benchmark = Benchmark_Start();
 
-        if (savegame_info->level_title) {
-            if (savegame_info->counter > g_SaveCounter) {
-                g_SaveCounter = savegame_info->counter;
-            }
-            g_SavedGamesCount++;
-        }
+    // A single listing per directory tells which slots exist and whether
+    // they changed since they were last parsed.
+    FILE_LISTING *const saves_listing = File_ListDirectory(SAVES_DIR);
+    FILE_LISTING *const game_listing = File_ListDirectory("");
+    for (int32_t i = 0; i < m_SaveSlots; i++) {
+        M_ScanSlot(i, saves_listing, game_listing);
     }
+    File_FreeListing(saves_listing);
+    File_FreeListing(game_listing);
 
-    REQUEST_INFO *req = &g_SavegameRequester;
-    Requester_ClearTextstrings(req);
-    Requester_Init(&g_SavegameRequester, Savegame_GetSlotCount());
-
-    for (int i = 0; i < req->max_items; i++) {
-        SAVEGAME_INFO *savegame_info = &m_SavegameInfo[i];
-
-        if (savegame_info->level_title) {
-            if (savegame_info->counter == g_SaveCounter) {
-                m_NewestSlot = i;
-            }
-            Requester_AddItem(
-                req, false, "%s %d", savegame_info->level_title,
-                savegame_info->counter);
-        } else {
-            Requester_AddItem(req, true, GS(MISC_EMPTY_SLOT_FMT), i + 1);
-        }
-    }
-
-    if (req->requested >= req->vis_lines) {
-        req->line_offset = req->requested - req->vis_lines + 1;
-    } else if (req->requested < req->line_offset) {
-        req->line_offset = req->requested;
-    }
-
-    g_SaveCounter++;
+    M_RefreshSlots();
+    Benchmark_End(benchmark, nullptr);
 }
 
 void Savegame_ScanAvailableLevels(REQUEST_INFO *req)
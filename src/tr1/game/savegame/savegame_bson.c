@@ -11,7 +11,6 @@
 #include "game/lot.h"
 #include "game/music.h"
 #include "game/room.h"
-#include "game/shell.h"
 #include "game/stats.h"
 #include "global/const.h"
 #include "global/vars.h"
@@ -26,6 +25,7 @@
 
 #include <inttypes.h>
 #include <stdio.h>
+#include <string.h>
 #include <zconf.h>
 #include <zlib.h>
 
@@ -46,7 +46,8 @@ typedef struct {
     int16_t id_map[NUM_EFFECTS];
 } SAVEGAME_BSON_FX_ORDER;
 
-static void M_SaveRaw(MYFILE *fp, JSON_VALUE *root, int32_t version);
+static char *M_Serialize(JSON_VALUE *root, int32_t version, size_t *out_size);
+static bool M_Encode(char **data, size_t *size);
 static JSON_VALUE *M_ParseFromBuffer(
     const char *buffer, size_t buffer_size, int32_t *version_out);
 static JSON_VALUE *M_ParseFromFile(MYFILE *fp, int32_t *version_out);
@@ -87,34 +88,52 @@ static void M_GetFXOrder(SAVEGAME_BSON_FX_ORDER *order);
 static bool M_IsValidItemObject(
     GAME_OBJECT_ID saved_obj_id, GAME_OBJECT_ID current_obj_id);
 
-static void M_SaveRaw(MYFILE *fp, JSON_VALUE *root, int32_t version)
+static char *M_Serialize(
+    JSON_VALUE *const root, const int32_t version, size_t *const out_size)
 {
     size_t uncompressed_size;
     char *uncompressed = BSON_Write(root, &uncompressed_size);
 
-    uLongf compressed_size = compressBound(uncompressed_size);
-    char *compressed = Memory_Alloc(compressed_size);
-    if (compress(
-            (Bytef *)compressed, &compressed_size, (const Bytef *)uncompressed,
-            (uLongf)uncompressed_size)
-        != Z_OK) {
-        Shell_ExitSystem("Failed to compress savegame data");
-    }
-
-    Memory_FreePointer(&uncompressed);
-
-    SAVEGAME_BSON_HEADER header = {
+    // The header is filled in right away, as it depends on the game state.
+    // Compressing the payload is left to M_Encode.
+    const SAVEGAME_BSON_HEADER header = {
         .magic = SAVEGAME_BSON_MAGIC,
         .initial_version = g_GameInfo.save_initial_version,
         .version = version,
-        .compressed_size = compressed_size,
+        .compressed_size = 0,
         .uncompressed_size = uncompressed_size,
     };
 
-    File_WriteData(fp, &header, sizeof(header));
-    File_WriteData(fp, compressed, compressed_size);
+    *out_size = sizeof(header) + uncompressed_size;
+    char *const data = Memory_Alloc(*out_size);
+    memcpy(data, &header, sizeof(header));
+    memcpy(data + sizeof(header), uncompressed, uncompressed_size);
+    Memory_FreePointer(&uncompressed);
+    return data;
+}
+
+static bool M_Encode(char **const data, size_t *const size)
+{
+    SAVEGAME_BSON_HEADER header;
+    memcpy(&header, *data, sizeof(header));
+
+    uLongf compressed_size = compressBound(header.uncompressed_size);
+    char *const output = Memory_Alloc(sizeof(header) + compressed_size);
+    if (compress(
+            (Bytef *)(output + sizeof(header)), &compressed_size,
+            (const Bytef *)(*data + sizeof(header)),
+            (uLongf)header.uncompressed_size)
+        != Z_OK) {
+        Memory_Free(output);
+        return false;
+    }
 
-    Memory_FreePointer(&compressed);
+    header.compressed_size = compressed_size;
+    memcpy(output, &header, sizeof(header));
+    Memory_Free(*data);
+    *data = output;
+    *size = sizeof(header) + compressed_size;
+    return true;
 }
 
 static void M_GetFXOrder(SAVEGAME_BSON_FX_ORDER *order)
@@ -1448,7 +1467,8 @@ cleanup:
     return ret;
 }
 
-void Savegame_BSON_SaveToFile(MYFILE *fp, GAME_INFO *game_info)
+void Savegame_BSON_SaveToFile(
+    const int32_t slot_num, const char *const path, GAME_INFO *game_info)
 {
     ASSERT(game_info != nullptr);
 
@@ -1473,15 +1493,26 @@ void Savegame_BSON_SaveToFile(MYFILE *fp, GAME_INFO *game_info)
         root_obj, "music_track_flags", M_DumpMusicTrackFlags());
 
     JSON_VALUE *root = JSON_ValueFromObject(root_obj);
-    M_SaveRaw(fp, root, SAVEGAME_CURRENT_VERSION);
+    size_t size;
+    char *const data = M_Serialize(root, SAVEGAME_CURRENT_VERSION, &size);
     JSON_ValueFree(root);
+
+    // Compression and disk access happen on the writer thread.
+    Savegame_WriteAsync(slot_num, path, data, size, M_Encode);
 }
 
-bool Savegame_BSON_UpdateDeathCounters(MYFILE *fp, GAME_INFO *game_info)
+bool Savegame_BSON_UpdateDeathCounters(
+    const int32_t slot_num, const char *const path, GAME_INFO *const game_info)
 {
+    MYFILE *const fp = File_Open(path, FILE_OPEN_READ);
+    if (fp == nullptr) {
+        return false;
+    }
+
     bool result = false;
     int32_t version;
     JSON_VALUE *const root = M_ParseFromFile(fp, &version);
+    File_Close(fp);
     JSON_OBJECT *const root_obj = JSON_ValueAsObject(root);
     if (root_obj == nullptr) {
         LOG_ERROR("Cannot find the root object");
@@ -1496,8 +1527,11 @@ bool Savegame_BSON_UpdateDeathCounters(MYFILE *fp, GAME_INFO *game_info)
     JSON_ObjectEvictKey(misc_obj, "death_count");
     JSON_ObjectAppendInt(misc_obj, "death_count", game_info->death_count);
 
-    File_Seek(fp, 0, FILE_SEEK_SET);
-    M_SaveRaw(fp, root, version);
+    // Rewriting the file in place could leave it corrupt, so it is replaced
+    // like any other save.
+    size_t size;
+    char *const data = M_Serialize(root, version, &size);
+    Savegame_WriteAsync(slot_num, path, data, size, M_Encode);
     result = true;
 
 cleanup:
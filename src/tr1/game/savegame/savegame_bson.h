@@ -13,5 +13,7 @@ char *Savegame_BSON_GetSaveFileName(int32_t slot);
 bool Savegame_BSON_FillInfo(MYFILE *fp, SAVEGAME_INFO *info);
 bool Savegame_BSON_LoadFromFile(MYFILE *fp, GAME_INFO *game_info);
 bool Savegame_BSON_LoadOnlyResumeInfo(MYFILE *fp, GAME_INFO *game_info);
-void Savegame_BSON_SaveToFile(MYFILE *fp, GAME_INFO *game_info);
-bool Savegame_BSON_UpdateDeathCounters(MYFILE *fp, GAME_INFO *game_info);
+void Savegame_BSON_SaveToFile(
+    int32_t slot_num, const char *path, GAME_INFO *game_info);
+bool Savegame_BSON_UpdateDeathCounters(
+    int32_t slot_num, const char *path, GAME_INFO *game_info);
@@ -579,7 +579,8 @@ bool Savegame_Legacy_LoadOnlyResumeInfo(MYFILE *fp, GAME_INFO *game_info)
 }
 
 bool Savegame_Legacy_UpdateDeathCounters(
-    MYFILE *const fp, GAME_INFO *const game_info)
+    const int32_t slot_num, const char *const path,
+    GAME_INFO *const game_info)
 {
     return false;
 }
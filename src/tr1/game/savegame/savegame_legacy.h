@@ -13,4 +13,5 @@ char *Savegame_Legacy_GetSaveFileName(int32_t slot);
 bool Savegame_Legacy_FillInfo(MYFILE *fp, SAVEGAME_INFO *info);
 bool Savegame_Legacy_LoadFromFile(MYFILE *fp, GAME_INFO *game_info);
 bool Savegame_Legacy_LoadOnlyResumeInfo(MYFILE *fp, GAME_INFO *game_info);
-bool Savegame_Legacy_UpdateDeathCounters(MYFILE *fp, GAME_INFO *game_info);
+bool Savegame_Legacy_UpdateDeathCounters(
+    int32_t slot_num, const char *path, GAME_INFO *game_info);
@@ -26,8 +26,10 @@
 #include <libtrx/filesystem.h>
 #include <libtrx/game/game_buf.h>
 #include <libtrx/game/game_string_table.h>
+#include <libtrx/game/objects/names.h>
 #include <libtrx/game/ui/common.h>
 #include <libtrx/memory.h>
+#include <libtrx/strings.h>
 
 #include <stdarg.h>
 #include <stdint.h>
@@ -140,6 +142,7 @@ void Shell_Shutdown(void)
 {
     Console_Shutdown();
     GameBuf_Shutdown();
+    Memory_FrameShutdown();
     Savegame_Shutdown();
     GF_Shutdown();
 
@@ -150,6 +153,8 @@ void Shell_Shutdown(void)
     UI_Shutdown();
     Text_Shutdown();
     Config_Shutdown();
+    Object_ShutdownNames();
+    String_Shutdown();
     Log_Shutdown();
 }
 
@@ -6,6 +6,7 @@
 #include "global/vars.h"
 
 #include <libtrx/config.h>
+#include <libtrx/memory.h>
 
 #define TEXT_BOX_OFFSET 2
 
@@ -38,6 +39,8 @@ static void M_DrawTextBackground(
 static void M_DrawTextOutline(
     UI_STYLE ui_style, int32_t sx, int32_t sy, int32_t w, int32_t h,
     TEXT_STYLE text_style);
+static bool M_IsLayoutValid(const TEXTSTRING *text, const OBJECT *obj);
+static void M_UpdateLayout(TEXTSTRING *text, const OBJECT *obj);
 
 static void M_DrawTextBackground(
     const UI_STYLE ui_style, const int32_t sx, const int32_t sy, int32_t w,
@@ -108,39 +111,38 @@ static void M_DrawTextOutline(
     }
 }
 
-RGBA_8888 Text_GetMenuColor(MENU_COLOR color)
+static bool M_IsLayoutValid(
+    const TEXTSTRING *const text, const OBJECT *const obj)
 {
-    return m_MenuColorMap[color];
+    return !text->layout.is_dirty
+        && text->layout.key.res_w == Screen_GetResWidth()
+        && text->layout.key.res_h == Screen_GetResHeight()
+        && text->layout.key.ui_scale == g_Config.ui.text_scale
+        && text->layout.key.mesh_idx == obj->mesh_idx
+        && text->layout.key.mesh_count == obj->mesh_count;
 }
 
-void Text_DrawText(TEXTSTRING *const text)
+static void M_UpdateLayout(TEXTSTRING *const text, const OBJECT *const obj)
 {
-    if (text->flags.drawn) {
-        return;
-    }
-    text->flags.drawn = 1;
-
-    if (text->flags.hide || text->glyphs == nullptr) {
-        return;
+    int32_t glyph_count = 0;
+    for (const GLYPH_INFO **glyph_ptr = text->glyphs; *glyph_ptr != nullptr;
+         glyph_ptr++) {
+        glyph_count++;
     }
 
-    const OBJECT *const obj = Object_Get(O_ALPHABET);
-    if (!obj->loaded) {
-        return;
-    }
-
-    if (text->flags.flash) {
-        text->flash.count -= Clock_GetFrameAdvance();
-        if (text->flash.count <= -text->flash.rate) {
-            text->flash.count = text->flash.rate;
-        } else if (text->flash.count < 0) {
-            return;
-        }
+    // Compound glyphs take up two sprites.
+    Memory_FreePointer(&text->layout.sprites);
+    if (glyph_count > 0) {
+        text->layout.sprites =
+            Memory_Alloc(sizeof(TEXT_GLYPH_SPRITE) * glyph_count * 2);
     }
+    text->layout.sprite_count = 0;
+    text->layout.scale.h = Screen_GetRenderScale(text->scale.h, RSR_TEXT);
+    text->layout.scale.v = Screen_GetRenderScale(text->scale.v, RSR_TEXT);
 
     double x = text->pos.x;
     double y = text->pos.y;
-    int32_t text_width = Text_GetWidth(text);
+    const int32_t text_width = Text_GetWidth(text);
 
     if (text->flags.centre_h) {
         x += (Screen_GetResWidthDownscaled(RSR_TEXT) - text_width) / 2;
@@ -155,13 +157,9 @@ void Text_DrawText(TEXTSTRING *const text)
     }
 
     int32_t bxpos = text->background.offset.x + x - TEXT_BOX_OFFSET;
-    int32_t bypos =
+    const int32_t bypos =
         text->background.offset.y + y - TEXT_BOX_OFFSET * 2 - TEXT_HEIGHT;
 
-    int32_t sx;
-    int32_t sy;
-    int32_t sh;
-    int32_t sv;
     const int32_t start_x = x;
 
     const GLYPH_INFO **glyph_ptr = text->glyphs;
@@ -177,30 +175,34 @@ void Text_DrawText(TEXTSTRING *const text)
             goto loop_end;
         }
 
-        sx = Screen_GetRenderScale(x, RSR_TEXT);
-        sy = Screen_GetRenderScale(y, RSR_TEXT);
-        sh = Screen_GetRenderScale(text->scale.h, RSR_TEXT);
-        sv = Screen_GetRenderScale(text->scale.v, RSR_TEXT);
+        const int32_t sx = Screen_GetRenderScale(x, RSR_TEXT);
+        const int32_t sy = Screen_GetRenderScale(y, RSR_TEXT);
 
         if (glyph->role == GLYPH_COMPOUND) {
-            const int32_t csx = sx
-                + Screen_GetRenderScale(glyph->combine_with.offset_x, RSR_TEXT);
-            const int32_t csy = sy
-                + Screen_GetRenderScale(glyph->combine_with.offset_y, RSR_TEXT);
             if (glyph->combine_with.mesh_idx >= ABS(obj->mesh_count)) {
                 goto loop_end;
             }
-
-            Output_DrawScreenSprite(
-                csx, csy, 0, sh, sv,
-                obj->mesh_idx + glyph->combine_with.mesh_idx, 16 << 8, 0, 0);
+            text->layout.sprites[text->layout.sprite_count++] =
+                (TEXT_GLYPH_SPRITE) {
+                    .x = sx
+                        + Screen_GetRenderScale(
+                            glyph->combine_with.offset_x, RSR_TEXT),
+                    .y = sy
+                        + Screen_GetRenderScale(
+                            glyph->combine_with.offset_y, RSR_TEXT),
+                    .sprite_num = obj->mesh_idx + glyph->combine_with.mesh_idx,
+                };
         }
 
         if (glyph->mesh_idx >= ABS(obj->mesh_count)) {
             goto loop_end;
         }
-        Output_DrawScreenSprite(
-            sx, sy, 0, sh, sv, obj->mesh_idx + glyph->mesh_idx, 16 << 8, 0, 0);
+        text->layout.sprites[text->layout.sprite_count++] =
+            (TEXT_GLYPH_SPRITE) {
+                .x = sx,
+                .y = sy,
+                .sprite_num = obj->mesh_idx + glyph->mesh_idx,
+            };
 
         if (glyph->role != GLYPH_COMBINING) {
             x += (text->letter_spacing + glyph->width) * text->scale.h
@@ -212,37 +214,81 @@ void Text_DrawText(TEXTSTRING *const text)
 
     int32_t bwidth = 0;
     int32_t bheight = 0;
-    if (text->flags.background || text->flags.outline) {
-        if (text->background.size.x) {
-            bxpos += text_width / 2;
-            bxpos -= text->background.size.x / 2;
-            bwidth = text->background.size.x + TEXT_BOX_OFFSET * 2;
-        } else {
-            bwidth = text_width + TEXT_BOX_OFFSET * 2;
-        }
-        if (text->background.size.y) {
-            bheight = text->background.size.y;
-        } else {
-            bheight = TEXT_HEIGHT + 7;
+    if (text->background.size.x) {
+        bxpos += text_width / 2;
+        bxpos -= text->background.size.x / 2;
+        bwidth = text->background.size.x + TEXT_BOX_OFFSET * 2;
+    } else {
+        bwidth = text_width + TEXT_BOX_OFFSET * 2;
+    }
+    if (text->background.size.y) {
+        bheight = text->background.size.y;
+    } else {
+        bheight = TEXT_HEIGHT + 7;
+    }
+
+    text->layout.box.x = Screen_GetRenderScale(bxpos, RSR_TEXT);
+    text->layout.box.y = Screen_GetRenderScale(bypos, RSR_TEXT);
+    text->layout.box.w = Screen_GetRenderScale(bwidth, RSR_TEXT);
+    text->layout.box.h = Screen_GetRenderScale(bheight, RSR_TEXT);
+
+    text->layout.key.res_w = Screen_GetResWidth();
+    text->layout.key.res_h = Screen_GetResHeight();
+    text->layout.key.ui_scale = g_Config.ui.text_scale;
+    text->layout.key.mesh_idx = obj->mesh_idx;
+    text->layout.key.mesh_count = obj->mesh_count;
+    text->layout.is_dirty = false;
+}
+
+RGBA_8888 Text_GetMenuColor(MENU_COLOR color)
+{
+    return m_MenuColorMap[color];
+}
+
+void Text_DrawText(TEXTSTRING *const text)
+{
+    if (text->flags.drawn) {
+        return;
+    }
+    text->flags.drawn = 1;
+
+    if (text->flags.hide || text->glyphs == nullptr) {
+        return;
+    }
+
+    const OBJECT *const obj = Object_Get(O_ALPHABET);
+    if (!obj->loaded) {
+        return;
+    }
+
+    if (text->flags.flash) {
+        text->flash.count -= Clock_GetFrameAdvance();
+        if (text->flash.count <= -text->flash.rate) {
+            text->flash.count = text->flash.rate;
+        } else if (text->flash.count < 0) {
+            return;
         }
     }
 
-    if (text->flags.background) {
-        sx = Screen_GetRenderScale(bxpos, RSR_TEXT);
-        sy = Screen_GetRenderScale(bypos, RSR_TEXT);
-        sh = Screen_GetRenderScale(bwidth, RSR_TEXT);
-        sv = Screen_GetRenderScale(bheight, RSR_TEXT);
+    if (!M_IsLayoutValid(text, obj)) {
+        M_UpdateLayout(text, obj);
+    }
+
+    Output_DrawScreenSprites(
+        text->layout.sprites, text->layout.sprite_count, text->layout.scale.h,
+        text->layout.scale.v);
 
+    const int32_t sx = text->layout.box.x;
+    const int32_t sy = text->layout.box.y;
+    const int32_t sh = text->layout.box.w;
+    const int32_t sv = text->layout.box.h;
+
+    if (text->flags.background) {
         M_DrawTextBackground(
             g_Config.ui.menu_style, sx, sy, sh, sv, text->background.style);
     }
 
     if (text->flags.outline) {
-        sx = Screen_GetRenderScale(bxpos, RSR_TEXT);
-        sy = Screen_GetRenderScale(bypos, RSR_TEXT);
-        sh = Screen_GetRenderScale(bwidth, RSR_TEXT);
-        sv = Screen_GetRenderScale(bheight, RSR_TEXT);
-
         M_DrawTextOutline(
             g_Config.ui.menu_style, sx, sy, sh, sv, text->outline.style);
     }
@@ -51,6 +51,11 @@ static void M_FlipPrimaryBuffer(void);
 static void M_ClearSurface(GFX_2D_SURFACE *surface);
 static void M_DrawTriangleFan(GFX_3D_VERTEX *vertices, int vertex_count);
 static void M_DrawTriangleStrip(GFX_3D_VERTEX *vertices, int vertex_count);
+static void M_FillSpriteVertices(
+    GFX_3D_VERTEX *vertices, int32_t x1, int32_t y1, int32_t x2, int32_t y2,
+    int32_t z, const SPRITE_TEXTURE *sprite, int32_t shade);
+static void M_DrawSpriteList(
+    const GFX_3D_VERTEX *vertices, int32_t vertex_count, int32_t tex_page);
 static int32_t M_VisibleZClip(
     const PHD_VBUF *vn1, const PHD_VBUF *vn2, const PHD_VBUF *vn3);
 static int32_t M_ZedClipper(
@@ -308,7 +313,8 @@ void S_Output_DownloadBackdropSurface(const IMAGE *const image)
 
     m_PictureSurface = GFX_2D_Surface_CreateFromImage(image);
     GFX_2D_Renderer_Upload(
-        m_Renderer2D, &m_PictureSurface->desc, m_PictureSurface->buffer);
+        m_Renderer2D, &m_PictureSurface->desc, m_PictureSurface->buffer,
+        nullptr);
 }
 
 void S_Output_SelectTexture(const int32_t texture_num)
@@ -327,15 +333,13 @@ void S_Output_SelectTexture(const int32_t texture_num)
     m_SelectedTexture = texture_num;
 }
 
-void S_Output_DrawSprite(
-    int16_t x1, int16_t y1, int16_t x2, int y2, int z, int sprnum, int shade)
+static void M_FillSpriteVertices(
+    GFX_3D_VERTEX *const vertices, const int32_t x1, const int32_t y1,
+    const int32_t x2, const int32_t y2, const int32_t z,
+    const SPRITE_TEXTURE *const sprite, const int32_t shade)
 {
-    int vertex_count = 4;
-    GFX_3D_VERTEX vertices[vertex_count * CLIP_VERTCOUNT_SCALE];
-
     float multiplier = g_Config.visuals.brightness / 16.0f;
 
-    const SPRITE_TEXTURE *const sprite = Output_GetSpriteTexture(sprnum);
     float vshade = (8192.0f - shade) * multiplier;
     if (vshade >= 256.0f) {
         vshade = 255.0f;
@@ -387,10 +391,29 @@ void S_Output_DrawSprite(
     vertices[3].r = vshade;
     vertices[3].g = vshade;
     vertices[3].b = vshade;
+}
 
-    if (!vertex_count) {
-        return;
+static void M_DrawSpriteList(
+    const GFX_3D_VERTEX *const vertices, const int32_t vertex_count,
+    const int32_t tex_page)
+{
+    if (m_TextureMap[tex_page] != GFX_NO_TEXTURE) {
+        S_Output_EnableTextureMode();
+        S_Output_SelectTexture(tex_page);
+    } else {
+        S_Output_DisableTextureMode();
     }
+    GFX_3D_Renderer_RenderPrimList(m_Renderer3D, vertices, vertex_count);
+}
+
+void S_Output_DrawSprite(
+    int16_t x1, int16_t y1, int16_t x2, int y2, int z, int sprnum, int shade)
+{
+    int vertex_count = 4;
+    GFX_3D_VERTEX vertices[vertex_count * CLIP_VERTCOUNT_SCALE];
+
+    const SPRITE_TEXTURE *const sprite = Output_GetSpriteTexture(sprnum);
+    M_FillSpriteVertices(vertices, x1, y1, x2, y2, z, sprite, shade);
 
     if (m_TextureMap[sprite->tex_page] != GFX_NO_TEXTURE) {
         S_Output_EnableTextureMode();
@@ -402,6 +425,42 @@ void S_Output_DrawSprite(
     }
 }
 
+void S_Output_DrawSprites(
+    const S_OUTPUT_SPRITE *const sprites, const int32_t count, const int z,
+    const int shade)
+{
+    if (count <= 0) {
+        return;
+    }
+
+    // Emit the quads as a plain triangle list, splitting it only when the
+    // texture page changes. The triangles match what a fan would produce.
+    GFX_3D_VERTEX vertices[count * 6];
+    int32_t vertex_count = 0;
+    int32_t tex_page = -1;
+    for (int32_t i = 0; i < count; i++) {
+        const S_OUTPUT_SPRITE *const item = &sprites[i];
+        const SPRITE_TEXTURE *const sprite =
+            Output_GetSpriteTexture(item->sprite_num);
+        if (vertex_count > 0 && sprite->tex_page != tex_page) {
+            M_DrawSpriteList(vertices, vertex_count, tex_page);
+            vertex_count = 0;
+        }
+        tex_page = sprite->tex_page;
+
+        GFX_3D_VERTEX quad[4];
+        M_FillSpriteVertices(
+            quad, item->x0, item->y0, item->x1, item->y1, z, sprite, shade);
+        vertices[vertex_count++] = quad[0];
+        vertices[vertex_count++] = quad[1];
+        vertices[vertex_count++] = quad[2];
+        vertices[vertex_count++] = quad[0];
+        vertices[vertex_count++] = quad[2];
+        vertices[vertex_count++] = quad[3];
+    }
+    M_DrawSpriteList(vertices, vertex_count, tex_page);
+}
+
 void S_Output_Draw3DLine(
     const PHD_VBUF *const vn0, const PHD_VBUF *const vn1, const RGBA_8888 color)
 {
@@ -974,33 +1033,49 @@ void S_Output_DrawTexturedQuad(
 }
 
 void S_Output_DownloadTextures(int32_t pages)
+{
+    S_Output_BeginTextureDownload(pages);
+    for (int32_t i = 0; i < pages; i++) {
+        S_Output_DownloadTexturePage(i);
+    }
+    S_Output_EndTextureDownload();
+}
+
+void S_Output_BeginTextureDownload(const int32_t pages)
 {
     if (pages > GFX_MAX_TEXTURES) {
         Shell_ExitSystem("Attempt to download more than texture page limit");
     }
 
     M_ReleaseTextures();
+    GFX_3D_Renderer_BeginTexturePages(
+        m_Renderer3D, pages, TEXTURE_PAGE_WIDTH, TEXTURE_PAGE_HEIGHT);
+}
 
-    for (int32_t i = 0; i < pages; i++) {
-        if (m_TextureSurfaces[i] == nullptr) {
-            const GFX_2D_SURFACE_DESC surface_desc = {
-                .width = TEXTURE_PAGE_WIDTH,
-                .height = TEXTURE_PAGE_HEIGHT,
-            };
-            m_TextureSurfaces[i] = GFX_2D_Surface_Create(&surface_desc);
-        }
-        GFX_2D_SURFACE *const surface = m_TextureSurfaces[i];
-        RGBA_8888 *const output_ptr = (RGBA_8888 *)surface->buffer;
-        const RGBA_8888 *const input_ptr = Output_GetTexturePage32(i);
-        memcpy(
-            output_ptr, input_ptr,
-            surface->desc.width * surface->desc.height * sizeof(RGBA_8888));
-
-        m_TextureMap[i] = GFX_3D_Renderer_RegisterTexturePage(
-            m_Renderer3D, output_ptr, surface->desc.width,
-            surface->desc.height);
+void S_Output_DownloadTexturePage(const int32_t page)
+{
+    ASSERT(page >= 0 && page < GFX_MAX_TEXTURES);
+    if (m_TextureSurfaces[page] == nullptr) {
+        const GFX_2D_SURFACE_DESC surface_desc = {
+            .width = TEXTURE_PAGE_WIDTH,
+            .height = TEXTURE_PAGE_HEIGHT,
+        };
+        m_TextureSurfaces[page] = GFX_2D_Surface_Create(&surface_desc);
     }
+    GFX_2D_SURFACE *const surface = m_TextureSurfaces[page];
+    RGBA_8888 *const output_ptr = (RGBA_8888 *)surface->buffer;
+    const RGBA_8888 *const input_ptr = Output_GetTexturePage32(page);
+    memcpy(
+        output_ptr, input_ptr,
+        surface->desc.width * surface->desc.height * sizeof(RGBA_8888));
+
+    m_TextureMap[page] = GFX_3D_Renderer_RegisterTexturePage(
+        m_Renderer3D, output_ptr, surface->desc.width, surface->desc.height);
+}
 
+void S_Output_EndTextureDownload(void)
+{
+    GFX_3D_Renderer_EndTexturePages(m_Renderer3D);
     m_SelectedTexture = -1;
 
     m_EnvMapTexture = GFX_3D_Renderer_RegisterEnvironmentMap(m_Renderer3D);
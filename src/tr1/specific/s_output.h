@@ -7,6 +7,14 @@
 
 #include <stdint.h>
 
+typedef struct {
+    int32_t x0;
+    int32_t y0;
+    int32_t x1;
+    int32_t y1;
+    int32_t sprite_num;
+} S_OUTPUT_SPRITE;
+
 bool S_Output_Init(void);
 void S_Output_Shutdown(void);
 
@@ -28,6 +36,9 @@ void S_Output_SetWindowSize(int width, int height);
 void S_Output_ApplyRenderSettings(void);
 
 void S_Output_DownloadTextures(int32_t pages);
+void S_Output_BeginTextureDownload(int32_t pages);
+void S_Output_DownloadTexturePage(int32_t page);
+void S_Output_EndTextureDownload(void);
 void S_Output_SelectTexture(int32_t texture_num);
 void S_Output_DownloadBackdropSurface(const IMAGE *image);
 void S_Output_DrawBackdropSurface(void);
@@ -49,6 +60,9 @@ void S_Output_Draw3DLine(
     const PHD_VBUF *vn1, const PHD_VBUF *vn2, const RGBA_8888 color);
 void S_Output_DrawSprite(
     int16_t x1, int16_t y1, int16_t x2, int y2, int z, int sprnum, int shade);
+// Draws many screen space sprites sharing the same depth and shade at once.
+void S_Output_DrawSprites(
+    const S_OUTPUT_SPRITE *sprites, int32_t count, int z, int shade);
 void S_Output_Draw2DQuad(
     int32_t x1, int32_t y1, int32_t x2, int32_t y2, RGBA_8888 tl, RGBA_8888 tr,
     RGBA_8888 bl, RGBA_8888 br);
@@ -18,6 +18,7 @@
 #include <libtrx/debug.h>
 #include <libtrx/filesystem.h>
 #include <libtrx/game/music.h>
+#include <libtrx/game/savegame.h>
 
 #include <stdio.h>
 #include <string.h>
@@ -999,19 +1000,24 @@ void GetSavedGamesList(REQUEST_INFO *const req)
 
 bool S_FrontEndCheck(void)
 {
+    Savegame_WaitForWrites();
     Requester_Init(&g_LoadGameRequester);
 
+    // List the directory once rather than probing every slot separately.
+    FILE_LISTING *const listing = File_ListDirectory("");
+
     g_SavedGames = 0;
     for (int32_t i = 0; i < MAX_REQUESTER_ITEMS; i++) {
         char file_name[80];
         sprintf(file_name, "savegame.%d", i);
 
-        if (!File_Exists(file_name)) {
+        const FILE_ENTRY *const entry = File_FindEntry(listing, file_name);
+        if (entry == nullptr) {
             Requester_AddItem(
                 &g_LoadGameRequester, GS(MISC_EMPTY_SLOT), 0, 0, 0);
             g_SavedLevels[i] = false;
         } else {
-            MYFILE *const fp = File_Open(file_name, FILE_OPEN_READ);
+            MYFILE *const fp = File_Open(entry->name, FILE_OPEN_READ);
             char level_title[80];
             File_ReadData(fp, level_title, 75);
             const int32_t save_num = File_ReadS32(fp);
@@ -1032,6 +1038,7 @@ bool S_FrontEndCheck(void)
             g_SavedGames++;
         }
     }
+    File_FreeListing(listing);
 
     memcpy(m_ReqFlags1, g_RequesterFlags1, sizeof(m_ReqFlags1));
     memcpy(m_ReqFlags2, g_RequesterFlags2, sizeof(m_ReqFlags2));
@@ -1041,13 +1048,12 @@ bool S_FrontEndCheck(void)
 
 int32_t S_SaveGame(const int32_t slot_num)
 {
-    char file_name[80];
-    sprintf(file_name, "savegame.%d", slot_num);
+    char path[80];
+    sprintf(path, "savegame.%d", slot_num);
 
-    MYFILE *const fp = File_Open(file_name, FILE_OPEN_WRITE);
-    if (fp == nullptr) {
-        return false;
-    }
+    // Serialize on the game thread, hand the disk write to a worker.
+    MYFILE *const fp = File_OpenMemory();
+    char file_name[80];
 
     const GF_LEVEL *const current_level =
         GF_GetLevel(GFLT_MAIN, g_SaveGame.current_level);
@@ -1071,7 +1077,11 @@ int32_t S_SaveGame(const int32_t slot_num)
     }
     File_WriteS16(fp, 0);
     File_WriteData(fp, g_SaveGame.buffer, MAX_SG_BUFFER_SIZE);
-    File_Close(fp);
+
+    char *data = nullptr;
+    size_t size = 0;
+    File_CloseMemory(fp, &data, &size);
+    Savegame_WriteAsync(slot_num, path, data, size, nullptr);
 
     char save_num_text[16];
     sprintf(save_num_text, "%d", g_SaveCounter);
@@ -1092,6 +1102,7 @@ int32_t S_LoadGame(const int32_t slot_num)
 {
     char file_name[80];
     sprintf(file_name, "savegame.%d", slot_num);
+    Savegame_WaitForSlot(slot_num);
 
     MYFILE *const fp = File_Open(file_name, FILE_OPEN_READ);
     if (fp == nullptr) {
@@ -1114,6 +1125,7 @@ int32_t S_LoadGame(const int32_t slot_num)
     }
     File_ReadS16(fp);
     File_ReadData(fp, g_SaveGame.buffer, MAX_SG_BUFFER_SIZE);
+    const bool result = !File_HasError(fp);
     File_Close(fp);
-    return true;
+    return result;
 }
@@ -82,7 +82,8 @@ static void M_UploadSurface(void *const surface, void *const user_data)
 {
     GFX_2D_RENDERER *renderer_2d = user_data;
     GFX_2D_SURFACE *surface_ = surface;
-    GFX_2D_Renderer_Upload(renderer_2d, &surface_->desc, surface_->buffer);
+    GFX_2D_Renderer_Upload(
+        renderer_2d, &surface_->desc, surface_->buffer, nullptr);
     GFX_2D_Renderer_Render(renderer_2d);
 }
 
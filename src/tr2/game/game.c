@@ -15,6 +15,7 @@
 #include "game/music.h"
 #include "game/output.h"
 #include "game/overlay.h"
+#include "game/room.h"
 #include "game/room_draw.h"
 #include "game/shell.h"
 #include "game/sound.h"
@@ -137,6 +138,7 @@ GF_COMMAND Game_Control(const bool demo_mode)
     Effect_Control();
     Lara_Control(false);
     Lara_Hair_Control(false);
+    Room_PrefetchMusic(g_LaraItem->room_num);
     Camera_Update();
     Sound_UpdateEffects();
     Sound_EndScene();
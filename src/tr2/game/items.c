@@ -10,6 +10,7 @@
 #include "global/vars.h"
 
 #include <libtrx/debug.h>
+#include <libtrx/game/item_grid.h>
 #include <libtrx/game/math.h>
 #include <libtrx/game/matrix.h>
 #include <libtrx/utils.h>
@@ -113,6 +114,7 @@ void Item_Initialise(const int16_t item_num)
     ROOM *const room = Room_Get(item->room_num);
     item->next_item = room->item_num;
     room->item_num = item_num;
+    ItemGrid_Link(item_num);
 
     const SECTOR *const sector =
         Room_GetWorldSector(room, item->pos.x, item->pos.z);
@@ -271,10 +271,14 @@ static void M_CompleteSetup(void)
     BENCHMARK *const benchmark = Benchmark_Start();
 
     Inject_AllInjections();
+    Benchmark_Tick(benchmark, "injections");
 
     Level_LoadAnimFrames(&m_LevelInfo);
     Level_LoadAnimCommands();
+    Benchmark_Tick(benchmark, "animations");
+
     Level_LoadObjectsAndItems();
+    Benchmark_Tick(benchmark, "objects and items");
 
     Level_LoadTexturePages(&m_LevelInfo);
     Level_LoadPalettes(&m_LevelInfo);
@@ -282,15 +286,16 @@ static void M_CompleteSetup(void)
 
     Render_Reset(
         RENDER_RESET_PALETTE | RENDER_RESET_TEXTURES | RENDER_RESET_UVS);
+    Benchmark_Tick(benchmark, "textures and palettes");
 
     M_InitialiseSoundEffects();
-
-    Benchmark_End(benchmark, nullptr);
+    Benchmark_End(benchmark, "sound effects");
 }
 
 bool Level_Load(const GF_LEVEL *const level)
 {
     BENCHMARK *const benchmark = Benchmark_Start();
+    const size_t peak_rss = Benchmark_GetPeakRSS();
 
     Audio_Sample_CloseAll();
     Audio_Sample_UnloadAll();
@@ -310,6 +315,9 @@ bool Level_Load(const GF_LEVEL *const level)
 
     Inject_Cleanup();
 
+    LOG_DEBUG(
+        "peak RSS: %zu KiB before, %zu KiB after", peak_rss / 1024,
+        Benchmark_GetPeakRSS() / 1024);
     Benchmark_End(benchmark, nullptr);
 
     return true;
@@ -342,6 +350,7 @@ bool Level_Initialise(const GF_LEVEL *const level)
     if (!Level_Load(level)) {
         return false;
     }
+    Room_ResetMusicPrefetch();
     GameStringTable_Apply(level);
 
     if (g_Lara.item_num != NO_ITEM) {
@@ -177,31 +177,9 @@ void LOT_CreateZone(ITEM *const item)
 {
     CREATURE *const creature = item->data;
 
-    const int16_t *zone;
-    const int16_t *flip;
-    if (creature->lot.fly) {
-        zone = Box_GetFlyZone(false);
-        flip = Box_GetFlyZone(true);
-    } else {
-        zone = Box_GetGroundZone(false, BOX_ZONE(creature->lot.step));
-        flip = Box_GetGroundZone(true, BOX_ZONE(creature->lot.step));
-    }
-
     const ROOM *const room = Room_Get(item->room_num);
     item->box_num = Room_GetWorldSector(room, item->pos.x, item->pos.z)->box;
-
-    int16_t zone_num = zone[item->box_num];
-    int16_t flip_num = flip[item->box_num];
-
-    creature->lot.zone_count = 0;
-    BOX_NODE *node = creature->lot.node;
-    for (int32_t i = 0; i < Box_GetCount(); i++) {
-        if (zone[i] == zone_num || flip[i] == flip_num) {
-            node->box_num = i;
-            node++;
-            creature->lot.zone_count++;
-        }
-    }
+    Box_FillZone(&creature->lot, item->box_num);
 }
 
 void LOT_ClearLOT(LOT_INFO *const lot)
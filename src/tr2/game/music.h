@@ -4,9 +4,14 @@
 
 #include <libtrx/game/music.h>
 
+#define MUSIC_MAX_PREFETCHED_TRACKS 2
+
 bool Music_Init(void);
 void Music_Shutdown(void);
 void Music_Stop(void);
+// Hints that the track is likely to be played soon. Backends that support it
+// open the track in the background so that playing it does not stall.
+void Music_Prefetch(MUSIC_TRACK_ID track_id);
 bool Music_PlaySynced(int16_t track_id);
 double Music_GetTimestamp(void);
 bool Music_SeekTimestamp(double timestamp);
@@ -6,6 +6,9 @@ typedef struct MUSIC_BACKEND {
     bool (*init)(struct MUSIC_BACKEND *backend);
     const char *(*describe)(const struct MUSIC_BACKEND *backend);
     int32_t (*play)(const struct MUSIC_BACKEND *backend, int32_t track_id);
+    // Optional. Opens the track ahead of time so that a later play call for
+    // it can start right away.
+    void (*prefetch)(const struct MUSIC_BACKEND *backend, int32_t track_id);
     void (*shutdown)(struct MUSIC_BACKEND *backend);
     void *data;
 } MUSIC_BACKEND;
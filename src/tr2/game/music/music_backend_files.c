@@ -1,24 +1,39 @@
 
 #include "game/music/music_backend_files.h"
 
+#include "game/music.h"
+
 #include <libtrx/debug.h>
 #include <libtrx/engine/audio.h>
 #include <libtrx/filesystem.h>
 #include <libtrx/log.h>
 #include <libtrx/memory.h>
 
+typedef struct {
+    int32_t track_id;
+    int32_t stream_id;
+} PREFETCHED_TRACK;
+
 typedef struct {
     const char *dir;
     const char *description;
+    // Paused streams, oldest first.
+    PREFETCHED_TRACK prefetched[MUSIC_MAX_PREFETCHED_TRACKS];
 } BACKEND_DATA;
 
 static const char *m_ExtensionsToTry[] = { ".flac", ".ogg", ".mp3", ".wav",
                                            nullptr };
 
 static char *M_GetTrackFileName(const char *base_dir, int32_t track);
+static int32_t M_OpenTrack(
+    const BACKEND_DATA *data, int32_t track_id, bool is_paused);
+static void M_DropFailedPrefetches(BACKEND_DATA *data);
+static int32_t M_TakePrefetched(BACKEND_DATA *data, int32_t track_id);
+static void M_ClosePrefetched(BACKEND_DATA *data);
 static const char *M_Describe(const MUSIC_BACKEND *backend);
 static bool M_Init(MUSIC_BACKEND *backend);
 static int32_t M_Play(const MUSIC_BACKEND *backend, int32_t track_id);
+static void M_Prefetch(const MUSIC_BACKEND *backend, int32_t track_id);
 static void M_Shutdown(MUSIC_BACKEND *backend);
 
 static char *M_GetTrackFileName(const char *base_dir, int32_t track)
@@ -34,6 +49,67 @@ static char *M_GetTrackFileName(const char *base_dir, int32_t track)
     return result;
 }
 
+static int32_t M_OpenTrack(
+    const BACKEND_DATA *const data, const int32_t track_id,
+    const bool is_paused)
+{
+    char *file_path = M_GetTrackFileName(data->dir, track_id);
+    if (file_path == nullptr) {
+        LOG_ERROR("Invalid track: %d", track_id);
+        return -1;
+    }
+
+    // Opening and probing the file can take a while on slow drives, so it
+    // is done off the main thread.
+    const int32_t stream_id =
+        Audio_Stream_CreateFromFileAsync(file_path, is_paused);
+    Memory_Free(file_path);
+    return stream_id;
+}
+
+static void M_DropFailedPrefetches(BACKEND_DATA *const data)
+{
+    // Prefetched streams have no finish callback, so failed loads are not
+    // closed by the mixer and have to be released here.
+    for (int32_t i = 0; i < MUSIC_MAX_PREFETCHED_TRACKS; i++) {
+        PREFETCHED_TRACK *const entry = &data->prefetched[i];
+        if (entry->stream_id >= 0
+            && Audio_Stream_IsLoadFailed(entry->stream_id)) {
+            Audio_Stream_Close(entry->stream_id);
+            entry->track_id = -1;
+            entry->stream_id = -1;
+        }
+    }
+}
+
+static int32_t M_TakePrefetched(
+    BACKEND_DATA *const data, const int32_t track_id)
+{
+    M_DropFailedPrefetches(data);
+    for (int32_t i = 0; i < MUSIC_MAX_PREFETCHED_TRACKS; i++) {
+        PREFETCHED_TRACK *const entry = &data->prefetched[i];
+        if (entry->stream_id >= 0 && entry->track_id == track_id) {
+            const int32_t stream_id = entry->stream_id;
+            entry->track_id = -1;
+            entry->stream_id = -1;
+            return stream_id;
+        }
+    }
+    return -1;
+}
+
+static void M_ClosePrefetched(BACKEND_DATA *const data)
+{
+    for (int32_t i = 0; i < MUSIC_MAX_PREFETCHED_TRACKS; i++) {
+        PREFETCHED_TRACK *const entry = &data->prefetched[i];
+        if (entry->stream_id >= 0) {
+            Audio_Stream_Close(entry->stream_id);
+        }
+        entry->track_id = -1;
+        entry->stream_id = -1;
+    }
+}
+
 static bool M_Init(MUSIC_BACKEND *const backend)
 {
     ASSERT(backend != nullptr);
@@ -54,18 +130,46 @@ static int32_t M_Play(
     const MUSIC_BACKEND *const backend, const int32_t track_id)
 {
     ASSERT(backend != nullptr);
-    const BACKEND_DATA *const data = backend->data;
+    BACKEND_DATA *const data = backend->data;
     ASSERT(data != nullptr);
 
-    char *file_path = M_GetTrackFileName(data->dir, track_id);
-    if (file_path == nullptr) {
-        LOG_ERROR("Invalid track: %d", track_id);
-        return -1;
+    // Prefetched streams are handed over paused; the caller unpauses them
+    // once the volume and looping are set up.
+    const int32_t stream_id = M_TakePrefetched(data, track_id);
+    if (stream_id >= 0) {
+        return stream_id;
     }
+    return M_OpenTrack(data, track_id, false);
+}
 
-    const int32_t stream_id = Audio_Stream_CreateFromFile(file_path);
-    Memory_Free(file_path);
-    return stream_id;
+static void M_Prefetch(
+    const MUSIC_BACKEND *const backend, const int32_t track_id)
+{
+    ASSERT(backend != nullptr);
+    BACKEND_DATA *const data = backend->data;
+    ASSERT(data != nullptr);
+
+    M_DropFailedPrefetches(data);
+    for (int32_t i = 0; i < MUSIC_MAX_PREFETCHED_TRACKS; i++) {
+        const PREFETCHED_TRACK *const entry = &data->prefetched[i];
+        if (entry->stream_id >= 0 && entry->track_id == track_id) {
+            return;
+        }
+    }
+
+    // Evict the oldest entry to make room.
+    PREFETCHED_TRACK *const oldest = &data->prefetched[0];
+    if (oldest->stream_id >= 0) {
+        Audio_Stream_Close(oldest->stream_id);
+    }
+    for (int32_t i = 1; i < MUSIC_MAX_PREFETCHED_TRACKS; i++) {
+        data->prefetched[i - 1] = data->prefetched[i];
+    }
+
+    PREFETCHED_TRACK *const entry =
+        &data->prefetched[MUSIC_MAX_PREFETCHED_TRACKS - 1];
+    entry->track_id = track_id;
+    entry->stream_id = M_OpenTrack(data, track_id, true);
 }
 
 static void M_Shutdown(MUSIC_BACKEND *backend)
@@ -76,6 +180,7 @@ static void M_Shutdown(MUSIC_BACKEND *backend)
 
     if (backend->data != nullptr) {
         BACKEND_DATA *const data = backend->data;
+        M_ClosePrefetched(data);
         Memory_FreePointer(&data->dir);
         Memory_FreePointer(&data->description);
     }
@@ -95,12 +200,17 @@ MUSIC_BACKEND *Music_Backend_Files_Factory(const char *path)
     BACKEND_DATA *data = Memory_Alloc(sizeof(BACKEND_DATA));
     data->dir = Memory_DupStr(path);
     data->description = description;
+    for (int32_t i = 0; i < MUSIC_MAX_PREFETCHED_TRACKS; i++) {
+        data->prefetched[i].track_id = -1;
+        data->prefetched[i].stream_id = -1;
+    }
 
     MUSIC_BACKEND *backend = Memory_Alloc(sizeof(MUSIC_BACKEND));
     backend->data = data;
     backend->init = M_Init;
     backend->describe = M_Describe;
     backend->play = M_Play;
+    backend->prefetch = M_Prefetch;
     backend->shutdown = M_Shutdown;
     return backend;
 }
@@ -150,6 +150,7 @@ bool Music_Play(const MUSIC_TRACK_ID track_id, const MUSIC_PLAY_MODE mode)
     Audio_Stream_SetIsLooped(m_AudioStreamID, mode == MPM_LOOPED);
     Audio_Stream_SetVolume(m_AudioStreamID, m_MusicVolume);
     Audio_Stream_SetFinishCallback(m_AudioStreamID, M_StreamFinished, nullptr);
+    Audio_Stream_Unpause(m_AudioStreamID);
 
 finish:
     m_TrackDelayed = MX_INACTIVE;
@@ -174,6 +175,17 @@ void Music_Stop(void)
     M_StopActiveStream();
 }
 
+void Music_Prefetch(const MUSIC_TRACK_ID track_id)
+{
+    if (m_Backend == nullptr || m_Backend->prefetch == nullptr) {
+        return;
+    }
+    if (track_id == m_TrackCurrent || track_id == m_TrackLooped) {
+        return;
+    }
+    m_Backend->prefetch(m_Backend, Music_GetRealTrack(track_id));
+}
+
 bool Music_PlaySynced(int16_t track_id)
 {
     Music_Play(track_id, false);
@@ -255,7 +255,8 @@ void Render_LoadBackgroundFromTexture(
         },
         .pitch = TEXTURE_PAGE_WIDTH * 2,
     };
-    GFX_2D_Renderer_Upload(m_BackgroundRenderer, &desc, (uint8_t *)page);
+    GFX_2D_Renderer_Upload(
+        m_BackgroundRenderer, &desc, (uint8_t *)page, nullptr);
     GFX_2D_Renderer_SetRepeat(m_BackgroundRenderer, repeat_x, repeat_y);
     GFX_2D_Renderer_SetEffect(m_BackgroundRenderer, GFX_2D_EFFECT_VIGNETTE);
 }
@@ -272,7 +273,8 @@ void Render_LoadBackgroundFromImage(const IMAGE *const image)
     m_Background.texture = nullptr;
     m_Background.repeat_x = 1;
     m_Background.repeat_y = 1;
-    GFX_2D_Renderer_UploadSurface(m_BackgroundRenderer, m_Background.surface);
+    GFX_2D_Renderer_UploadSurface(
+        m_BackgroundRenderer, m_Background.surface, nullptr);
     GFX_2D_Renderer_SetRepeat(m_BackgroundRenderer, 1, 1);
     GFX_2D_Renderer_SetEffect(m_BackgroundRenderer, GFX_2D_EFFECT_NONE);
 }
@@ -210,6 +210,9 @@ static void M_LoadTexturePages(RENDERER *renderer)
     M_ReleaseTextures(renderer);
 
     const int32_t pages_count = Output_GetTexturePageCount();
+    GFX_3D_Renderer_BeginTexturePages(
+        priv->renderer_3d, pages_count, TEXTURE_PAGE_WIDTH,
+        TEXTURE_PAGE_HEIGHT);
     for (int32_t i = 0; i < pages_count; i++) {
         GFX_2D_SURFACE *const surface = priv->surface_tex[i];
         const RGBA_8888 *input_ptr = Output_GetTexturePage32(i);
@@ -220,6 +223,7 @@ static void M_LoadTexturePages(RENDERER *renderer)
             priv->renderer_3d, surface->buffer, surface->desc.width,
             surface->desc.height);
     }
+    GFX_3D_Renderer_EndTexturePages(priv->renderer_3d);
 
     priv->env_map_texture =
         GFX_3D_Renderer_RegisterEnvironmentMap(priv->renderer_3d);
@@ -102,10 +102,23 @@ typedef struct {
 } XBUF_XGUVP;
 #pragma pack(pop)
 
+// Half-open range of surface rows, empty when y1 >= y2.
+typedef struct {
+    int32_t y1;
+    int32_t y2;
+} ROW_SPAN;
+
 static VERTEX_INFO m_VBuffer[32] = {};
 static void *m_XBuffer = nullptr;
 static int32_t m_XGenY1 = 0;
 static int32_t m_XGenY2 = 0;
+// Rows written to since the alpha surface was last cleared.
+static ROW_SPAN m_DrawnRows = {};
+// Rows that differ from what was last uploaded to the GPU.
+static ROW_SPAN m_DirtyRows = {};
+
+static void M_AddRows(ROW_SPAN *span, int32_t y1, int32_t y2);
+static void M_MarkRowsDrawn(int32_t y1, int32_t y2);
 
 static void M_FlatA(
     GFX_2D_SURFACE *alpha_surface, GFX_2D_SURFACE *target_surface, int32_t y1,
@@ -201,6 +214,26 @@ static void (*m_PolyDrawRoutines[])(
     // clang-format on
 };
 
+static void M_AddRows(ROW_SPAN *const span, const int32_t y1, const int32_t y2)
+{
+    if (y1 >= y2) {
+        return;
+    }
+    if (span->y1 >= span->y2) {
+        span->y1 = y1;
+        span->y2 = y2;
+    } else {
+        span->y1 = MIN(span->y1, y1);
+        span->y2 = MAX(span->y2, y2);
+    }
+}
+
+static void M_MarkRowsDrawn(const int32_t y1, const int32_t y2)
+{
+    M_AddRows(&m_DrawnRows, y1, y2);
+    M_AddRows(&m_DirtyRows, y1, y2);
+}
+
 static void M_FlatA(
     GFX_2D_SURFACE *const alpha_surface, GFX_2D_SURFACE *const target_surface,
     int32_t y1, int32_t y2, const uint8_t color_idx)
@@ -1052,6 +1085,7 @@ static void M_DrawPolyFlat(
     GFX_2D_SURFACE *const alpha_surface)
 {
     if (M_XGenX(obj_ptr + 1)) {
+        M_MarkRowsDrawn(m_XGenY1, m_XGenY2);
         M_FlatA(alpha_surface, target_surface, m_XGenY1, m_XGenY2, *obj_ptr);
     }
 }
@@ -1061,6 +1095,7 @@ static void M_DrawPolyTrans(
     GFX_2D_SURFACE *const alpha_surface)
 {
     if (M_XGenX(obj_ptr + 1)) {
+        M_MarkRowsDrawn(m_XGenY1, m_XGenY2);
         M_TransA(alpha_surface, target_surface, m_XGenY1, m_XGenY2, *obj_ptr);
     }
 }
@@ -1070,6 +1105,7 @@ static void M_DrawPolyGouraud(
     GFX_2D_SURFACE *const alpha_surface)
 {
     if (M_XGenXG(obj_ptr + 1)) {
+        M_MarkRowsDrawn(m_XGenY1, m_XGenY2);
         M_GourA(alpha_surface, target_surface, m_XGenY1, m_XGenY2, *obj_ptr);
     }
 }
@@ -1079,6 +1115,7 @@ static void M_DrawPolyGTMap(
     GFX_2D_SURFACE *const alpha_surface)
 {
     if (M_XGenXGUV(obj_ptr + 1)) {
+        M_MarkRowsDrawn(m_XGenY1, m_XGenY2);
         M_GTMapA(
             alpha_surface, target_surface, m_XGenY1, m_XGenY2,
             Output_GetTexturePage8(*obj_ptr));
@@ -1090,6 +1127,7 @@ static void M_DrawPolyWGTMap(
     GFX_2D_SURFACE *const alpha_surface)
 {
     if (M_XGenXGUV(obj_ptr + 1)) {
+        M_MarkRowsDrawn(m_XGenY1, m_XGenY2);
         M_WGTMapA(
             alpha_surface, target_surface, m_XGenY1, m_XGenY2,
             Output_GetTexturePage8(*obj_ptr));
@@ -1101,6 +1139,7 @@ static void M_DrawPolyGTMapPersp(
     GFX_2D_SURFACE *const alpha_surface)
 {
     if (M_XGenXGUVPerspFP(obj_ptr + 1)) {
+        M_MarkRowsDrawn(m_XGenY1, m_XGenY2);
         M_GTMapPersp32FP(
             alpha_surface, target_surface, m_XGenY1, m_XGenY2,
             Output_GetTexturePage8(*obj_ptr));
@@ -1112,6 +1151,7 @@ static void M_DrawPolyWGTMapPersp(
     GFX_2D_SURFACE *const alpha_surface)
 {
     if (M_XGenXGUVPerspFP(obj_ptr + 1)) {
+        M_MarkRowsDrawn(m_XGenY1, m_XGenY2);
         M_WGTMapPersp32FP(
             alpha_surface, target_surface, m_XGenY1, m_XGenY2,
             Output_GetTexturePage8(*obj_ptr));
@@ -1169,6 +1209,8 @@ static void M_DrawPolyLine(
         y2 = g_PhdWinMaxY;
     }
 
+    M_MarkRowsDrawn(y1, y2 + 1);
+
     int32_t x_size = x2 - x1;
     int32_t y_size = y2 - y1;
     PIX_FMT *target_ptr = &target_surface->buffer[x1 + target_stride * y1];
@@ -1263,6 +1305,8 @@ static void M_DrawScaledSpriteC(
     CLAMPG(x1, g_PhdWinMaxX + 1);
     CLAMPG(y1, g_PhdWinMaxY + 1);
 
+    M_MarkRowsDrawn(y0, y1);
+
     const int32_t target_stride = target_surface->desc.pitch;
     const int32_t width = x1 - x0;
     const int32_t height = y1 - y0;
@@ -1339,6 +1383,10 @@ static void M_Open(RENDERER *const renderer)
         ASSERT(priv->surface_alpha != nullptr);
     }
 
+    // The textures may still hold the contents of the previous surfaces.
+    m_DrawnRows = (ROW_SPAN) {};
+    m_DirtyRows = (ROW_SPAN) { .y1 = 0, .y2 = g_PhdWinHeight };
+
     renderer->open = true;
 }
 
@@ -1404,6 +1452,10 @@ static void M_BeginScene(RENDERER *const renderer)
     memset(
         priv->surface_alpha->buffer, 0,
         priv->surface_alpha->desc.pitch * priv->surface_alpha->desc.height);
+
+    // Clearing the alpha surface only affects rows that had been drawn to.
+    M_AddRows(&m_DirtyRows, m_DrawnRows.y1, m_DrawnRows.y2);
+    m_DrawnRows = (ROW_SPAN) {};
 }
 
 static void M_EndScene(RENDERER *const renderer)
@@ -1430,8 +1482,17 @@ static void M_DrawPolyList(RENDERER *const renderer)
             obj_ptr, priv->surface, priv->surface_alpha);
     }
 
-    GFX_2D_Renderer_UploadSurface(priv->renderer_2d, priv->surface);
-    GFX_2D_Renderer_UploadAlphaSurface(priv->renderer_2d, priv->surface_alpha);
+    const GFX_2D_RECT dirty_rect = {
+        .x = 0,
+        .y = m_DirtyRows.y1,
+        .w = priv->surface->desc.width,
+        .h = MAX(m_DirtyRows.y2 - m_DirtyRows.y1, 0),
+    };
+    GFX_2D_Renderer_UploadSurface(
+        priv->renderer_2d, priv->surface, &dirty_rect);
+    GFX_2D_Renderer_UploadAlphaSurface(
+        priv->renderer_2d, priv->surface_alpha, &dirty_rect);
+    m_DirtyRows = (ROW_SPAN) {};
     GFX_2D_Renderer_Render(priv->renderer_2d);
 }
 
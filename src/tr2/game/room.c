@@ -21,7 +21,12 @@
 
 void Room_MarkToBeDrawn(int16_t room_num);
 
+static int16_t m_MusicPrefetchRoomNum = NO_ROOM_NEG;
+
 static void M_TriggerMusicTrack(int16_t track, const TRIGGER *trigger);
+static bool M_IsMusicTriggerPending(int16_t track, const TRIGGER *trigger);
+static int32_t M_PrefetchRoomMusic(
+    int16_t room_num, int16_t *tracks, int32_t track_count);
 static bool M_TestLava(const ITEM *item);
 
 static void M_TriggerMusicTrack(
@@ -69,6 +74,55 @@ finish:
     Music_SetTrackFlags(track, flags);
 }
 
+static bool M_IsMusicTriggerPending(
+    const int16_t track, const TRIGGER *const trigger)
+{
+    if (track < MX_CUTSCENE_THE_GREAT_WALL || track >= MX_TITLE_THEME) {
+        return false;
+    }
+    return trigger->type == TT_SWITCH
+        || (Music_GetTrackFlags(track) & trigger->mask) == 0;
+}
+
+static int32_t M_PrefetchRoomMusic(
+    const int16_t room_num, int16_t *const tracks, int32_t track_count)
+{
+    const ROOM *const room = Room_Get(room_num);
+    const int32_t sector_count = room->size.x * room->size.z;
+    for (int32_t i = 0; i < sector_count; i++) {
+        const TRIGGER *const trigger = room->sectors[i].trigger;
+        if (trigger == nullptr) {
+            continue;
+        }
+
+        const TRIGGER_CMD *cmd = trigger->command;
+        for (; cmd != nullptr; cmd = cmd->next_cmd) {
+            if (cmd->type != TO_CD) {
+                continue;
+            }
+            const int16_t track = (int16_t)(intptr_t)cmd->parameter;
+            if (!M_IsMusicTriggerPending(track, trigger)) {
+                continue;
+            }
+
+            bool is_known = false;
+            for (int32_t j = 0; j < track_count; j++) {
+                is_known |= tracks[j] == track;
+            }
+            if (is_known) {
+                continue;
+            }
+
+            Music_Prefetch(track);
+            tracks[track_count++] = track;
+            if (track_count == MUSIC_MAX_PREFETCHED_TRACKS) {
+                return track_count;
+            }
+        }
+    }
+    return track_count;
+}
+
 static bool M_TestLava(const ITEM *const item)
 {
     if (item->hit_points < 0 || g_Lara.water_status == LWS_CHEAT
@@ -602,3 +656,32 @@ void Room_InitCinematic(void)
         }
     }
 }
+
+void Room_ResetMusicPrefetch(void)
+{
+    m_MusicPrefetchRoomNum = NO_ROOM_NEG;
+}
+
+void Room_PrefetchMusic(const int16_t room_num)
+{
+    if (room_num == m_MusicPrefetchRoomNum) {
+        return;
+    }
+    m_MusicPrefetchRoomNum = room_num;
+
+    // Tracks triggered in the current room come first, then the ones that
+    // are a single portal away.
+    int16_t tracks[MUSIC_MAX_PREFETCHED_TRACKS];
+    int32_t track_count = M_PrefetchRoomMusic(room_num, tracks, 0);
+
+    const PORTALS *const portals = Room_Get(room_num)->portals;
+    if (portals == nullptr) {
+        return;
+    }
+    for (int32_t i = 0;
+         i < portals->count && track_count < MUSIC_MAX_PREFETCHED_TRACKS;
+         i++) {
+        track_count = M_PrefetchRoomMusic(
+            portals->portal[i].room_num, tracks, track_count);
+    }
+}
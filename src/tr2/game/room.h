@@ -21,3 +21,11 @@ int32_t Room_GetWaterHeight(int32_t x, int32_t y, int32_t z, int16_t room_num);
 
 void Room_TestTriggers(const ITEM *item);
 void Room_TestSectorTrigger(const ITEM *item, const SECTOR *sector);
+
+// Opens the music tracks that the triggers in and around the given room may
+// start, so that they begin playing without a stall. Only does work when the
+// room changes.
+void Room_PrefetchMusic(int16_t room_num);
+// Forgets the last prefetched room, as room numbers do not carry over between
+// levels.
+void Room_ResetMusicPrefetch(void);
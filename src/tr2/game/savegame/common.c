@@ -29,6 +29,7 @@ void Savegame_Init(void)
 
 void Savegame_Shutdown(void)
 {
+    Savegame_WaitForWrites();
     Memory_FreePointer(&g_SaveGame.start);
 }
 
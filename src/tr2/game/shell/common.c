@@ -25,9 +25,11 @@
 #include <libtrx/enum_map.h>
 #include <libtrx/game/game_buf.h>
 #include <libtrx/game/game_string_table.h>
+#include <libtrx/game/objects/names.h>
 #include <libtrx/game/shell.h>
 #include <libtrx/game/ui/common.h>
 #include <libtrx/memory.h>
+#include <libtrx/strings.h>
 
 #include <SDL2/SDL.h>
 #include <stdarg.h>
@@ -440,8 +442,11 @@ void Shell_Shutdown(void)
     Text_Shutdown();
     UI_Shutdown();
     GameBuf_Shutdown();
+    Memory_FrameShutdown();
     Config_Shutdown();
     EnumMap_Shutdown();
+    Object_ShutdownNames();
+    String_Shutdown();
 }
 
 const char *Shell_GetConfigPath(void)